@@ -0,0 +1,194 @@
+#include "black_scholes.hpp"
+#include "monte_carlo.hpp"
+#include "normal_distribution.hpp"
+#include "philox.hpp"
+#include "sobol.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace implied_vol;
+
+namespace {
+
+struct Sampler {
+    std::string name;
+    SamplingMethod method;
+};
+
+double run_case(
+    const OptionSpec& spec,
+    double volatility,
+    const PathPayoff& payoff,
+    const MonteCarloSettings& settings,
+    double& elapsed_ms
+) {
+    auto start = std::chrono::steady_clock::now();
+    double price = MonteCarloEngine(settings).price(spec, volatility, payoff).price;
+    auto end = std::chrono::steady_clock::now();
+    elapsed_ms = std::chrono::duration<double, std::milli>(end - start).count();
+    return price;
+}
+
+double geometric_asian_call(const OptionSpec& spec, double volatility, size_t num_steps) {
+    double dt = spec.time_to_expiry / num_steps;
+    double n = static_cast<double>(num_steps);
+    double mean = std::log(spec.spot)
+                + (spec.risk_free_rate - 0.5 * volatility * volatility) * dt * (n + 1.0) / 2.0;
+    double variance = volatility * volatility * dt * (n + 1.0) * (2.0 * n + 1.0) / (6.0 * n);
+    double sd = std::sqrt(variance);
+    double d2 = (mean - std::log(spec.strike)) / sd;
+    double d1 = d2 + sd;
+    return std::exp(-spec.risk_free_rate * spec.time_to_expiry)
+         * (std::exp(mean + 0.5 * variance) * NormalDistribution::cdf(d1)
+            - spec.strike * NormalDistribution::cdf(d2));
+}
+
+std::pair<double, double> asian_reference(
+    const OptionSpec& spec,
+    double volatility,
+    size_t num_steps,
+    size_t num_replications,
+    size_t paths_per_replication,
+    uint64_t seed
+) {
+    double dt = spec.time_to_expiry / num_steps;
+    double drift = (spec.risk_free_rate - 0.5 * volatility * volatility) * dt;
+    double diffusion = volatility * std::sqrt(dt);
+    double discount = std::exp(-spec.risk_free_rate * spec.time_to_expiry);
+    double geometric = geometric_asian_call(spec, volatility, num_steps);
+    
+    Philox4x32 rng(seed);
+    BrownianBridge bridge(num_steps);
+    std::vector<double> shift(num_steps);
+    std::vector<double> uniforms(num_steps);
+    std::vector<double> normals(num_steps);
+    std::vector<double> increments(num_steps);
+    std::vector<double> means_x(num_replications);
+    std::vector<double> means_y(num_replications);
+    double sum_yy = 0.0;
+    double sum_xy = 0.0;
+    
+    // Each replication is the same Sobol point set under an independent
+    // random shift modulo 1, so the replication means are i.i.d. and give
+    // an honest standard error for the quasi-random estimate.
+    for (size_t rep = 0; rep < num_replications; ++rep) {
+        rng.uniforms(rep, 0, shift.data(), num_steps);
+        SobolSequence sobol(num_steps);
+        double sum_x = 0.0;
+        double sum_y = 0.0;
+        
+        for (size_t path = 0; path < paths_per_replication; ++path) {
+            sobol.next(uniforms.data());
+            for (size_t i = 0; i < num_steps; ++i) {
+                double u = uniforms[i] + shift[i];
+                uniforms[i] = (u < 1.0) ? u : u - 1.0;
+            }
+            NormalDistribution::inverse_cdf(uniforms.data(), normals.data(), num_steps);
+            bridge.build_increments(normals.data(), increments.data());
+            
+            double log_spot = std::log(spec.spot);
+            double arithmetic = 0.0;
+            double log_sum = 0.0;
+            for (double z : increments) {
+                log_spot += drift + diffusion * z;
+                arithmetic += std::exp(log_spot);
+                log_sum += log_spot;
+            }
+            double x = discount * std::max(arithmetic / num_steps - spec.strike, 0.0);
+            double y = discount * std::max(std::exp(log_sum / num_steps) - spec.strike, 0.0) - geometric;
+            sum_x += x;
+            sum_y += y;
+            sum_yy += y * y;
+            sum_xy += x * y;
+        }
+        
+        means_x[rep] = sum_x / paths_per_replication;
+        means_y[rep] = sum_y / paths_per_replication;
+    }
+    
+    double n = static_cast<double>(num_replications * paths_per_replication);
+    double mean_x = 0.0;
+    double mean_y = 0.0;
+    for (size_t rep = 0; rep < num_replications; ++rep) {
+        mean_x += means_x[rep] / num_replications;
+        mean_y += means_y[rep] / num_replications;
+    }
+    double cov = (sum_xy - n * mean_x * mean_y) / (n - 1.0);
+    double var_y = (sum_yy - n * mean_y * mean_y) / (n - 1.0);
+    double beta = cov / var_y;
+    
+    double price = mean_x - beta * mean_y;
+    double spread = 0.0;
+    for (size_t rep = 0; rep < num_replications; ++rep) {
+        double deviation = means_x[rep] - beta * means_y[rep] - price;
+        spread += deviation * deviation;
+    }
+    double standard_error = std::sqrt(spread / ((num_replications - 1.0) * num_replications));
+    return {price, standard_error};
+}
+
+void convergence_table(
+    const std::string& title,
+    const OptionSpec& spec,
+    double volatility,
+    const PathPayoff& payoff,
+    size_t num_steps,
+    double reference
+) {
+    std::vector<Sampler> samplers = {
+        {"pseudo", SamplingMethod::PSEUDO_RANDOM},
+        {"sobol", SamplingMethod::SOBOL},
+        {"sobol+bridge", SamplingMethod::SOBOL_BRIDGE},
+    };
+    
+    std::cout << "\n" << title << " (reference " << std::setprecision(8) << reference << ")\n";
+    std::cout << std::left << std::setw(14) << "sampler" << std::right << std::setw(10) << "paths"
+              << std::setw(12) << "time_ms" << std::setw(14) << "abs_error" << "\n";
+    
+    for (const auto& sampler : samplers) {
+        for (size_t log_paths = 12; log_paths <= 20; log_paths += 2) {
+            MonteCarloSettings settings;
+            settings.num_paths = size_t(1) << log_paths;
+            settings.num_steps = num_steps;
+            settings.antithetic = false;
+            settings.control_variate = false;
+            settings.sampling = sampler.method;
+            
+            double elapsed = 0.0;
+            double price = run_case(spec, volatility, payoff, settings, elapsed);
+            
+            std::cout << std::left << std::setw(14) << sampler.name << std::right
+                      << std::setw(10) << settings.num_paths
+                      << std::setw(12) << std::fixed << std::setprecision(2) << elapsed
+                      << std::setw(14) << std::scientific << std::setprecision(3)
+                      << std::abs(price - reference) << std::defaultfloat << "\n";
+        }
+    }
+}
+
+}
+
+int main() {
+    OptionSpec spec(100.0, 100.0, 1.0, 0.05, OptionType::CALL);
+    const double vol = 0.2;
+    
+    BlackScholesEngine bs;
+    convergence_table("European call, 1 step", spec, vol, PathPayoff(), 1, bs.price(spec, vol));
+    
+    PathPayoff asian(PathPayoffType::ASIAN);
+    std::pair<double, double> reference = asian_reference(spec, vol, 32, 16, size_t(1) << 20, 20240607);
+    std::cout << "\nAsian reference: 16 randomly shifted sobol+bridge replications of 2^20 paths, "
+              << "geometric Asian control variate, standard error "
+              << std::scientific << std::setprecision(3) << reference.second
+              << std::defaultfloat << "\n";
+    
+    convergence_table("Arithmetic Asian call, 32 steps", spec, vol, asian, 32, reference.first);
+    
+    return 0;
+}
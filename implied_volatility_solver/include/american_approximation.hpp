@@ -0,0 +1,47 @@
+#pragma once
+
+#include "option_types.hpp"
+#include "black_scholes.hpp"
+#include "implied_vol_solver.hpp"
+
+namespace implied_vol {
+
+enum class AmericanApproximation {
+    BARONE_ADESI_WHALEY,
+    JU_ZHONG
+};
+
+class AmericanApproximationEngine {
+public:
+    explicit AmericanApproximationEngine(AmericanApproximation method = AmericanApproximation::JU_ZHONG)
+        : method_(method) {}
+    
+    double price(const OptionSpec& spec, double volatility) const;
+    
+    double vega(const OptionSpec& spec, double volatility) const;
+    
+    PriceVega price_and_vega(const OptionSpec& spec, double volatility) const;
+    
+    double intrinsic_value(const OptionSpec& spec) const;
+    
+    double critical_price(const OptionSpec& spec, double volatility) const;
+    
+    AmericanApproximation method() const { return method_; }
+    
+private:
+    static constexpr int MAX_CRITICAL_ITERATIONS = 100;
+    static constexpr double CRITICAL_TOLERANCE = 1e-10;
+    
+    AmericanApproximation method_;
+    BlackScholesEngine bs_engine_;
+    
+    double solve_critical(const OptionSpec& spec, double volatility, double guess) const;
+    
+    PriceVega price_put(const OptionSpec& spec, double volatility, double& critical) const;
+};
+
+extern template class BasicImpliedVolSolver<AmericanApproximationEngine>;
+
+using AmericanImpliedVolSolver = BasicImpliedVolSolver<AmericanApproximationEngine>;
+
+}
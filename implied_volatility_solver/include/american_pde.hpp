@@ -0,0 +1,94 @@
+#pragma once
+
+#include "option_types.hpp"
+#include <cstddef>
+#include <vector>
+
+namespace implied_vol {
+
+enum class ExerciseStyle {
+    EUROPEAN,
+    AMERICAN
+};
+
+class TridiagonalSolver {
+public:
+    void factor(double lower, double diag, double upper, size_t size);
+    
+    void solve(const double* rhs, double* out) const;
+    
+    void solve_projected(const double* rhs, const double* obstacle, bool exercise_low, double* out) const;
+    
+    size_t size() const { return size_; }
+    
+private:
+    double lower_ = 0.0;
+    double upper_ = 0.0;
+    size_t size_ = 0;
+    std::vector<double> down_pivot_;
+    std::vector<double> up_pivot_;
+    mutable std::vector<double> scratch_;
+};
+
+class AmericanPDEEngine {
+public:
+    struct Workspace {
+        std::vector<double> spots;
+        std::vector<double> values;
+        std::vector<double> rhs;
+        std::vector<double> payoff;
+        TridiagonalSolver implicit;
+        TridiagonalSolver crank_nicolson;
+    };
+    
+    AmericanPDEEngine(
+        size_t space_steps = 200,
+        size_t time_steps = 100,
+        ExerciseStyle style = ExerciseStyle::AMERICAN
+    );
+    
+    double price(const OptionSpec& spec, double volatility) const;
+    
+    double price(const OptionSpec& spec, double volatility, Workspace& workspace) const;
+    
+    std::vector<double> price_batch(
+        const std::vector<OptionSpec>& specs,
+        const std::vector<double>& volatilities,
+        unsigned num_threads = 0
+    ) const;
+    
+    ImpliedVolResult implied_vol(
+        const OptionSpec& spec,
+        double market_price,
+        double tolerance = 1e-6,
+        int max_iterations = 50
+    ) const;
+    
+    ImpliedVolResult implied_vol(
+        const OptionSpec& spec,
+        double market_price,
+        Workspace& workspace,
+        double tolerance = 1e-6,
+        int max_iterations = 50
+    ) const;
+    
+    std::vector<ImpliedVolResult> implied_vol_batch(
+        const std::vector<OptionSpec>& specs,
+        const std::vector<double>& market_prices,
+        unsigned num_threads = 0
+    ) const;
+    
+    ExerciseStyle style() const { return style_; }
+    
+private:
+    static constexpr double NUM_STD_DEVS = 5.0;
+    static constexpr size_t SMOOTHING_STEPS = 4;
+    static constexpr double VOL_MIN = 0.001;
+    static constexpr double VOL_MAX = 5.0;
+    
+    size_t space_steps_;
+    size_t time_steps_;
+    ExerciseStyle style_;
+};
+
+}
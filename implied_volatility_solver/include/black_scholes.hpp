@@ -1,39 +1,201 @@
 #pragma once
 
 #include "option_types.hpp"
+#include "normal_distribution.hpp"
+#include <array>
+#include <cmath>
 
 namespace implied_vol {
 
-class BlackScholesEngine {
+template <typename Scalar>
+class BasicBlackScholesEngine {
 public:
-    double price(const OptionSpec& spec, double volatility) const;
+    using Spec = BasicOptionSpec<Scalar>;
     
-    double vega(const OptionSpec& spec, double volatility) const;
+    Scalar price(const Spec& spec, const Scalar& volatility) const;
     
-    double delta(const OptionSpec& spec, double volatility) const;
+    Scalar vega(const Spec& spec, const Scalar& volatility) const;
     
-    double gamma(const OptionSpec& spec, double volatility) const;
+    BasicPriceVega<Scalar> price_and_vega(const Spec& spec, const Scalar& volatility) const;
     
-    double theta(const OptionSpec& spec, double volatility) const;
+    Scalar delta(const Spec& spec, const Scalar& volatility) const;
     
-    double rho(const OptionSpec& spec, double volatility) const;
+    Scalar gamma(const Spec& spec, const Scalar& volatility) const;
     
-    double intrinsic_value(const OptionSpec& spec) const;
+    Scalar theta(const Spec& spec, const Scalar& volatility) const;
+    
+    Scalar rho(const Spec& spec, const Scalar& volatility) const;
+    
+    Scalar intrinsic_value(const Spec& spec) const;
     
     bool verify_put_call_parity(
-        double call_price,
-        double put_price,
-        const OptionSpec& spec,
+        const Scalar& call_price,
+        const Scalar& put_price,
+        const Spec& spec,
         double tolerance = 1e-4
     ) const;
     
 private:
+    using Normal = BasicNormalDistribution<Scalar>;
+    
     struct D1D2 {
-        double d1;
-        double d2;
+        Scalar d1;
+        Scalar d2;
     };
     
-    D1D2 calculate_d1_d2(const OptionSpec& spec, double volatility) const;
+    D1D2 calculate_d1_d2(const Spec& spec, const Scalar& volatility) const;
+};
+
+template <typename Scalar>
+typename BasicBlackScholesEngine<Scalar>::D1D2 BasicBlackScholesEngine<Scalar>::calculate_d1_d2(
+    const Spec& spec,
+    const Scalar& volatility
+) const {
+    using std::log;
+    using std::sqrt;
+    
+    Scalar sqrt_T = sqrt(spec.time_to_expiry);
+    Scalar vol_sqrt_T = volatility * sqrt_T;
+    
+    Scalar d1 = (log(spec.spot / spec.strike) +
+                 (spec.risk_free_rate + 0.5 * volatility * volatility) * spec.time_to_expiry)
+                / vol_sqrt_T;
+    Scalar d2 = d1 - vol_sqrt_T;
+    
+    return {d1, d2};
+}
+
+template <typename Scalar>
+Scalar BasicBlackScholesEngine<Scalar>::price(const Spec& spec, const Scalar& volatility) const {
+    using std::exp;
+    auto [d1, d2] = calculate_d1_d2(spec, volatility);
+    
+    Scalar discount_factor = exp(-spec.risk_free_rate * spec.time_to_expiry);
+    
+    if (spec.type == OptionType::CALL) {
+        return spec.spot * Normal::cdf(d1) -
+               spec.strike * discount_factor * Normal::cdf(d2);
+    } else {
+        return spec.strike * discount_factor * Normal::cdf(-d2) -
+               spec.spot * Normal::cdf(-d1);
+    }
+}
+
+template <typename Scalar>
+Scalar BasicBlackScholesEngine<Scalar>::vega(const Spec& spec, const Scalar& volatility) const {
+    using std::sqrt;
+    auto [d1, d2] = calculate_d1_d2(spec, volatility);
+    return spec.spot * Normal::pdf(d1) * sqrt(spec.time_to_expiry);
+}
+
+template <typename Scalar>
+BasicPriceVega<Scalar> BasicBlackScholesEngine<Scalar>::price_and_vega(
+    const Spec& spec,
+    const Scalar& volatility
+) const {
+    using std::exp;
+    using std::sqrt;
+    auto [d1, d2] = calculate_d1_d2(spec, volatility);
+    
+    Scalar sqrt_T = sqrt(spec.time_to_expiry);
+    Scalar discount_factor = exp(-spec.risk_free_rate * spec.time_to_expiry);
+    Scalar price = (spec.type == OptionType::CALL)
+        ? spec.spot * Normal::cdf(d1) - spec.strike * discount_factor * Normal::cdf(d2)
+        : spec.strike * discount_factor * Normal::cdf(-d2) - spec.spot * Normal::cdf(-d1);
+    
+    return {price, spec.spot * Normal::pdf(d1) * sqrt_T};
+}
+
+template <typename Scalar>
+Scalar BasicBlackScholesEngine<Scalar>::delta(const Spec& spec, const Scalar& volatility) const {
+    auto [d1, d2] = calculate_d1_d2(spec, volatility);
+    
+    if (spec.type == OptionType::CALL) {
+        return Normal::cdf(d1);
+    } else {
+        return Normal::cdf(d1) - 1.0;
+    }
+}
+
+template <typename Scalar>
+Scalar BasicBlackScholesEngine<Scalar>::gamma(const Spec& spec, const Scalar& volatility) const {
+    using std::sqrt;
+    auto [d1, d2] = calculate_d1_d2(spec, volatility);
+    return Normal::pdf(d1) / (spec.spot * volatility * sqrt(spec.time_to_expiry));
+}
+
+template <typename Scalar>
+Scalar BasicBlackScholesEngine<Scalar>::theta(const Spec& spec, const Scalar& volatility) const {
+    using std::exp;
+    using std::sqrt;
+    auto [d1, d2] = calculate_d1_d2(spec, volatility);
+    
+    Scalar sqrt_T = sqrt(spec.time_to_expiry);
+    Scalar discount_factor = exp(-spec.risk_free_rate * spec.time_to_expiry);
+    
+    Scalar term1 = -(spec.spot * Normal::pdf(d1) * volatility) / (2.0 * sqrt_T);
+    
+    if (spec.type == OptionType::CALL) {
+        Scalar term2 = spec.risk_free_rate * spec.strike * discount_factor * Normal::cdf(d2);
+        return term1 - term2;
+    } else {
+        Scalar term2 = spec.risk_free_rate * spec.strike * discount_factor * Normal::cdf(-d2);
+        return term1 + term2;
+    }
+}
+
+template <typename Scalar>
+Scalar BasicBlackScholesEngine<Scalar>::rho(const Spec& spec, const Scalar& volatility) const {
+    using std::exp;
+    auto [d1, d2] = calculate_d1_d2(spec, volatility);
+    
+    Scalar discount_factor = exp(-spec.risk_free_rate * spec.time_to_expiry);
+    
+    if (spec.type == OptionType::CALL) {
+        return spec.strike * spec.time_to_expiry * discount_factor * Normal::cdf(d2);
+    } else {
+        return -spec.strike * spec.time_to_expiry * discount_factor * Normal::cdf(-d2);
+    }
+}
+
+template <typename Scalar>
+Scalar BasicBlackScholesEngine<Scalar>::intrinsic_value(const Spec& spec) const {
+    Scalar payoff = (spec.type == OptionType::CALL)
+        ? spec.spot - spec.strike
+        : spec.strike - spec.spot;
+    return (payoff > 0.0) ? payoff : Scalar(0.0);
+}
+
+template <typename Scalar>
+bool BasicBlackScholesEngine<Scalar>::verify_put_call_parity(
+    const Scalar& call_price,
+    const Scalar& put_price,
+    const Spec& spec,
+    double tolerance
+) const {
+    using std::abs;
+    using std::exp;
+    Scalar lhs = call_price - put_price;
+    Scalar rhs = spec.spot - spec.strike * exp(-spec.risk_free_rate * spec.time_to_expiry);
+    return abs(lhs - rhs) < tolerance;
+}
+
+extern template class BasicBlackScholesEngine<double>;
+
+using BlackScholesEngine = BasicBlackScholesEngine<double>;
+
+struct BlackScholesSensitivities {
+    static constexpr size_t SPOT = 0;
+    static constexpr size_t VOLATILITY = 1;
+    static constexpr size_t TIME = 2;
+    static constexpr size_t RATE = 3;
+    static constexpr size_t NUM_INPUTS = 4;
+    
+    double price;
+    std::array<double, NUM_INPUTS> gradient;
+    std::array<std::array<double, NUM_INPUTS>, NUM_INPUTS> hessian;
 };
 
+BlackScholesSensitivities compute_sensitivities(const OptionSpec& spec, double volatility);
+
 }
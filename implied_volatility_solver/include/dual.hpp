@@ -0,0 +1,287 @@
+#pragma once
+
+#include "normal_distribution.hpp"
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+namespace implied_vol {
+
+template <typename Scalar, size_t N>
+class Dual {
+public:
+    Dual(const Scalar& value = Scalar()) : value_(value), gradient_() {}
+    
+    Dual(const Scalar& value, const std::array<Scalar, N>& gradient)
+        : value_(value), gradient_(gradient) {}
+    
+    static Dual variable(const Scalar& value, size_t index) {
+        Dual result(value);
+        result.gradient_[index] = Scalar(1.0);
+        return result;
+    }
+    
+    const Scalar& value() const { return value_; }
+    
+    const Scalar& derivative(size_t index) const { return gradient_[index]; }
+    
+    const std::array<Scalar, N>& gradient() const { return gradient_; }
+    
+    Dual& operator+=(const Dual& other) {
+        value_ += other.value_;
+        for (size_t i = 0; i < N; ++i) {
+            gradient_[i] += other.gradient_[i];
+        }
+        return *this;
+    }
+    
+    Dual& operator-=(const Dual& other) {
+        value_ -= other.value_;
+        for (size_t i = 0; i < N; ++i) {
+            gradient_[i] -= other.gradient_[i];
+        }
+        return *this;
+    }
+    
+    Dual& operator*=(const Dual& other) {
+        for (size_t i = 0; i < N; ++i) {
+            gradient_[i] = gradient_[i] * other.value_ + value_ * other.gradient_[i];
+        }
+        value_ *= other.value_;
+        return *this;
+    }
+    
+    Dual& operator/=(const Dual& other) {
+        Scalar inverse = Scalar(1.0) / other.value_;
+        value_ /= other.value_;
+        for (size_t i = 0; i < N; ++i) {
+            gradient_[i] = (gradient_[i] - value_ * other.gradient_[i]) * inverse;
+        }
+        return *this;
+    }
+    
+    Dual& operator+=(double scalar) {
+        value_ += scalar;
+        return *this;
+    }
+    
+    Dual& operator-=(double scalar) {
+        value_ -= scalar;
+        return *this;
+    }
+    
+    Dual& operator*=(double scalar) {
+        value_ *= scalar;
+        for (size_t i = 0; i < N; ++i) {
+            gradient_[i] *= scalar;
+        }
+        return *this;
+    }
+    
+    Dual& operator/=(double scalar) {
+        value_ /= scalar;
+        double inverse = 1.0 / scalar;
+        for (size_t i = 0; i < N; ++i) {
+            gradient_[i] *= inverse;
+        }
+        return *this;
+    }
+    
+    template <typename F, typename DF>
+    Dual apply(F&& f, DF&& df) const {
+        Scalar slope = df(value_);
+        Dual result(f(value_));
+        for (size_t i = 0; i < N; ++i) {
+            result.gradient_[i] = slope * gradient_[i];
+        }
+        return result;
+    }
+    
+private:
+    Scalar value_;
+    std::array<Scalar, N> gradient_;
+};
+
+template <size_t N>
+using HyperDual = Dual<Dual<double, N>, N>;
+
+template <size_t N>
+HyperDual<N> hyper_variable(double value, size_t index) {
+    return HyperDual<N>::variable(Dual<double, N>::variable(value, index), index);
+}
+
+inline double value_of(double x) { return x; }
+
+template <typename Scalar, size_t N>
+double value_of(const Dual<Scalar, N>& x) { return value_of(x.value()); }
+
+template <typename Scalar, size_t N>
+Dual<Scalar, N> operator+(const Dual<Scalar, N>& x) { return x; }
+
+template <typename Scalar, size_t N>
+Dual<Scalar, N> operator-(const Dual<Scalar, N>& x) {
+    Dual<Scalar, N> result(x);
+    result *= -1.0;
+    return result;
+}
+
+template <typename Scalar, size_t N>
+Dual<Scalar, N> operator+(Dual<Scalar, N> x, const Dual<Scalar, N>& y) { return x += y; }
+
+template <typename Scalar, size_t N>
+Dual<Scalar, N> operator+(Dual<Scalar, N> x, double y) { return x += y; }
+
+template <typename Scalar, size_t N>
+Dual<Scalar, N> operator-(Dual<Scalar, N> x, const Dual<Scalar, N>& y) { return x -= y; }
+
+template <typename Scalar, size_t N>
+Dual<Scalar, N> operator-(Dual<Scalar, N> x, double y) { return x -= y; }
+
+template <typename Scalar, size_t N>
+Dual<Scalar, N> operator*(Dual<Scalar, N> x, const Dual<Scalar, N>& y) { return x *= y; }
+
+template <typename Scalar, size_t N>
+Dual<Scalar, N> operator*(Dual<Scalar, N> x, double y) { return x *= y; }
+
+template <typename Scalar, size_t N>
+Dual<Scalar, N> operator/(Dual<Scalar, N> x, const Dual<Scalar, N>& y) { return x /= y; }
+
+template <typename Scalar, size_t N>
+Dual<Scalar, N> operator/(Dual<Scalar, N> x, double y) { return x /= y; }
+
+template <typename Scalar, size_t N>
+Dual<Scalar, N> operator+(double x, const Dual<Scalar, N>& y) { return y + x; }
+
+template <typename Scalar, size_t N>
+Dual<Scalar, N> operator-(double x, const Dual<Scalar, N>& y) { return -y + x; }
+
+template <typename Scalar, size_t N>
+Dual<Scalar, N> operator*(double x, const Dual<Scalar, N>& y) { return y * x; }
+
+template <typename Scalar, size_t N>
+Dual<Scalar, N> operator/(double x, const Dual<Scalar, N>& y) {
+    return Dual<Scalar, N>(Scalar(x)) / y;
+}
+
+template <typename Scalar, size_t N>
+bool operator<(const Dual<Scalar, N>& x, const Dual<Scalar, N>& y) { return x.value() < y.value(); }
+
+template <typename Scalar, size_t N>
+bool operator<(const Dual<Scalar, N>& x, double y) { return x.value() < y; }
+
+template <typename Scalar, size_t N>
+bool operator<(double x, const Dual<Scalar, N>& y) { return x < y.value(); }
+
+template <typename Scalar, size_t N>
+bool operator>(const Dual<Scalar, N>& x, const Dual<Scalar, N>& y) { return x.value() > y.value(); }
+
+template <typename Scalar, size_t N>
+bool operator>(const Dual<Scalar, N>& x, double y) { return x.value() > y; }
+
+template <typename Scalar, size_t N>
+bool operator>(double x, const Dual<Scalar, N>& y) { return x > y.value(); }
+
+template <typename Scalar, size_t N>
+bool operator<=(const Dual<Scalar, N>& x, const Dual<Scalar, N>& y) { return x.value() <= y.value(); }
+
+template <typename Scalar, size_t N>
+bool operator<=(const Dual<Scalar, N>& x, double y) { return x.value() <= y; }
+
+template <typename Scalar, size_t N>
+bool operator<=(double x, const Dual<Scalar, N>& y) { return x <= y.value(); }
+
+template <typename Scalar, size_t N>
+bool operator>=(const Dual<Scalar, N>& x, const Dual<Scalar, N>& y) { return x.value() >= y.value(); }
+
+template <typename Scalar, size_t N>
+bool operator>=(const Dual<Scalar, N>& x, double y) { return x.value() >= y; }
+
+template <typename Scalar, size_t N>
+bool operator>=(double x, const Dual<Scalar, N>& y) { return x >= y.value(); }
+
+template <typename Scalar, size_t N>
+bool operator==(const Dual<Scalar, N>& x, const Dual<Scalar, N>& y) { return x.value() == y.value(); }
+
+template <typename Scalar, size_t N>
+bool operator==(const Dual<Scalar, N>& x, double y) { return x.value() == y; }
+
+template <typename Scalar, size_t N>
+bool operator==(double x, const Dual<Scalar, N>& y) { return x == y.value(); }
+
+template <typename Scalar, size_t N>
+bool operator!=(const Dual<Scalar, N>& x, const Dual<Scalar, N>& y) { return x.value() != y.value(); }
+
+template <typename Scalar, size_t N>
+bool operator!=(const Dual<Scalar, N>& x, double y) { return x.value() != y; }
+
+template <typename Scalar, size_t N>
+bool operator!=(double x, const Dual<Scalar, N>& y) { return x != y.value(); }
+
+template <typename Scalar, size_t N>
+Dual<Scalar, N> exp(const Dual<Scalar, N>& x) {
+    using std::exp;
+    Scalar e = exp(x.value());
+    return x.apply([&](const Scalar&) { return e; }, [&](const Scalar&) { return e; });
+}
+
+template <typename Scalar, size_t N>
+Dual<Scalar, N> log(const Dual<Scalar, N>& x) {
+    using std::log;
+    return x.apply([](const Scalar& v) { return log(v); },
+                   [](const Scalar& v) { return Scalar(1.0) / v; });
+}
+
+template <typename Scalar, size_t N>
+Dual<Scalar, N> sqrt(const Dual<Scalar, N>& x) {
+    using std::sqrt;
+    Scalar root = sqrt(x.value());
+    return x.apply([&](const Scalar&) { return root; },
+                   [&](const Scalar&) { return 0.5 / root; });
+}
+
+template <typename Scalar, size_t N>
+Dual<Scalar, N> expm1(const Dual<Scalar, N>& x) {
+    using std::exp;
+    using std::expm1;
+    return x.apply([](const Scalar& v) { return expm1(v); },
+                   [](const Scalar& v) { return exp(v); });
+}
+
+template <typename Scalar, size_t N>
+Dual<Scalar, N> log1p(const Dual<Scalar, N>& x) {
+    using std::log1p;
+    return x.apply([](const Scalar& v) { return log1p(v); },
+                   [](const Scalar& v) { return Scalar(1.0) / (1.0 + v); });
+}
+
+template <typename Scalar, size_t N>
+Dual<Scalar, N> pow(const Dual<Scalar, N>& x, double exponent) {
+    using std::pow;
+    return x.apply([=](const Scalar& v) { return pow(v, exponent); },
+                   [=](const Scalar& v) { return exponent * pow(v, exponent - 1.0); });
+}
+
+template <typename Scalar, size_t N>
+Dual<Scalar, N> abs(const Dual<Scalar, N>& x) {
+    return (x < 0.0) ? -x : x;
+}
+
+template <typename Scalar, size_t N>
+class BasicNormalDistribution<Dual<Scalar, N>> {
+public:
+    static Dual<Scalar, N> cdf(const Dual<Scalar, N>& x) {
+        return x.apply(&BasicNormalDistribution<Scalar>::cdf, &BasicNormalDistribution<Scalar>::pdf);
+    }
+    
+    static Dual<Scalar, N> pdf(const Dual<Scalar, N>& x) {
+        Scalar density = BasicNormalDistribution<Scalar>::pdf(x.value());
+        return x.apply([&](const Scalar&) { return density; },
+                       [&](const Scalar& v) { return -v * density; });
+    }
+    
+    static double inverse_cdf(double p) {
+        return BasicNormalDistribution<double>::inverse_cdf(p);
+    }
+};
+
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include "option_types.hpp"
+#include <complex>
+#include <cstddef>
+#include <vector>
+
+namespace implied_vol {
+
+struct HestonParameters {
+    double v0;
+    double kappa;
+    double theta;
+    double vol_of_vol;
+    double rho;
+    
+    HestonParameters(double initial_variance, double mean_reversion, double long_run_variance,
+                     double vol_of_variance, double correlation)
+        : v0(initial_variance), kappa(mean_reversion), theta(long_run_variance),
+          vol_of_vol(vol_of_variance), rho(correlation) {}
+    
+    bool is_valid() const;
+};
+
+class HestonEngine {
+public:
+    explicit HestonEngine(size_t num_terms = 256, double truncation_width = 20.0);
+    
+    std::vector<double> price_strip(
+        const HestonParameters& params,
+        double spot,
+        double time_to_expiry,
+        double risk_free_rate,
+        const std::vector<double>& strikes,
+        OptionType type
+    ) const;
+    
+    double price(const HestonParameters& params, const OptionSpec& spec) const;
+    
+    size_t num_terms() const { return num_terms_; }
+    
+private:
+    struct ExpiryTerms {
+        double lower;
+        double range;
+        std::vector<double> weights;
+        std::vector<double> frequencies;
+        std::vector<double> damping;
+    };
+    
+    size_t num_terms_;
+    double truncation_width_;
+    
+    void prepare_expiry(
+        const HestonParameters& params,
+        double time_to_expiry,
+        double risk_free_rate,
+        ExpiryTerms& terms
+    ) const;
+    
+    std::complex<double> characteristic_function(
+        const HestonParameters& params,
+        double u,
+        double time_to_expiry,
+        double risk_free_rate
+    ) const;
+};
+
+struct HestonQuote {
+    double time_to_expiry;
+    double strike;
+    double market_price;
+    OptionType type;
+    
+    HestonQuote(double T, double K, double price, OptionType opt_type)
+        : time_to_expiry(T), strike(K), market_price(price), type(opt_type) {}
+};
+
+struct HestonCalibrationResult {
+    HestonParameters parameters;
+    double rms_error;
+    int iterations;
+    bool converged;
+};
+
+class HestonCalibrator {
+public:
+    HestonCalibrator(const HestonEngine& engine, double spot, double risk_free_rate);
+    
+    HestonCalibrationResult calibrate(
+        const std::vector<HestonQuote>& quotes,
+        const HestonParameters& initial_guess,
+        unsigned num_threads = 0
+    ) const;
+    
+private:
+    struct Strip {
+        double time_to_expiry;
+        OptionType type;
+        std::vector<double> strikes;
+        std::vector<size_t> quote_indices;
+    };
+    
+    static constexpr int MAX_ITERATIONS = 100;
+    static constexpr double TOLERANCE = 1e-12;
+    static constexpr size_t NUM_PARAMS = 5;
+    
+    const HestonEngine& engine_;
+    double spot_;
+    double risk_free_rate_;
+    
+    void residuals(
+        const std::vector<Strip>& strips,
+        const std::vector<HestonQuote>& quotes,
+        const double* x,
+        std::vector<double>& out
+    ) const;
+};
+
+}
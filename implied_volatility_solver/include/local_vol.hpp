@@ -0,0 +1,93 @@
+#pragma once
+
+#include "svi.hpp"
+#include <cstddef>
+#include <vector>
+
+namespace implied_vol {
+
+class LocalVolSurface {
+public:
+    LocalVolSurface(
+        double min_strike,
+        double max_strike,
+        size_t num_strikes,
+        const std::vector<double>& expiries,
+        std::vector<double> local_vols,
+        size_t clamped_nodes = 0
+    );
+    
+    double local_vol(double strike, double time_to_expiry) const;
+    
+    double strike(size_t index) const { return min_strike_ + index * dk_; }
+    
+    const double* row(size_t expiry_index) const { return values_.data() + expiry_index * num_strikes_; }
+    
+    const std::vector<double>& expiries() const { return expiries_; }
+    const std::vector<double>& data() const { return values_; }
+    size_t num_strikes() const { return num_strikes_; }
+    size_t clamped_nodes() const { return clamped_nodes_; }
+    
+private:
+    double min_strike_;
+    double dk_;
+    size_t num_strikes_;
+    std::vector<double> expiries_;
+    std::vector<double> values_;
+    size_t clamped_nodes_;
+};
+
+class LocalVolBuilder {
+public:
+    LocalVolBuilder(double spot, double risk_free_rate, unsigned num_threads = 0);
+    
+    LocalVolSurface build(
+        const SSVIParameters& params,
+        double min_strike,
+        double max_strike,
+        size_t num_strikes,
+        const std::vector<double>& expiries
+    ) const;
+    
+    LocalVolSurface build(
+        const std::vector<double>& slice_expiries,
+        const std::vector<SVIParameters>& slices,
+        double min_strike,
+        double max_strike,
+        size_t num_strikes,
+        const std::vector<double>& expiries
+    ) const;
+    
+    static double dupire_variance(
+        double log_moneyness,
+        double total_variance,
+        double dw_dk,
+        double d2w_dk2,
+        double dw_dt
+    );
+    
+private:
+    struct VarianceDerivatives {
+        double w;
+        double dw_dk;
+        double d2w_dk2;
+        double dw_dt;
+    };
+    
+    static constexpr double MIN_LOCAL_VARIANCE = 1e-8;
+    
+    double spot_;
+    double rate_;
+    unsigned num_threads_;
+    
+    template <typename Derivatives>
+    LocalVolSurface evaluate_grid(
+        Derivatives&& derivatives,
+        double min_strike,
+        double max_strike,
+        size_t num_strikes,
+        const std::vector<double>& expiries
+    ) const;
+};
+
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "option_types.hpp"
+#include "black_scholes.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace implied_vol {
+
+enum class PathPayoffType {
+    EUROPEAN,
+    ASIAN,
+    UP_AND_OUT,
+    DOWN_AND_OUT,
+    UP_AND_IN,
+    DOWN_AND_IN,
+    LOOKBACK
+};
+
+enum class SamplingMethod {
+    PSEUDO_RANDOM,
+    SOBOL,
+    SOBOL_BRIDGE
+};
+
+struct PathPayoff {
+    PathPayoffType kind;
+    double barrier;
+    
+    PathPayoff(PathPayoffType payoff_kind = PathPayoffType::EUROPEAN, double barrier_level = 0.0)
+        : kind(payoff_kind), barrier(barrier_level) {}
+    
+    bool is_barrier() const;
+};
+
+struct MonteCarloSettings {
+    size_t num_paths = 100000;
+    size_t num_steps = 1;
+    uint64_t seed = 42;
+    bool antithetic = true;
+    bool control_variate = true;
+    SamplingMethod sampling = SamplingMethod::PSEUDO_RANDOM;
+    unsigned num_threads = 0;
+};
+
+struct MonteCarloResult {
+    double price;
+    double standard_error;
+    size_t num_paths;
+    double control_beta;
+};
+
+class MonteCarloEngine {
+public:
+    static constexpr size_t BLOCK_SIZE = 1024;
+    static constexpr size_t LANES = 16;
+    
+    explicit MonteCarloEngine(const MonteCarloSettings& settings = MonteCarloSettings());
+    
+    MonteCarloResult price(
+        const OptionSpec& spec,
+        double volatility,
+        const PathPayoff& payoff = PathPayoff()
+    ) const;
+    
+    const MonteCarloSettings& settings() const { return settings_; }
+    
+private:
+    struct Moments {
+        double count = 0.0;
+        double sum_x = 0.0;
+        double sum_y = 0.0;
+        double sum_xx = 0.0;
+        double sum_yy = 0.0;
+        double sum_xy = 0.0;
+    };
+    
+    MonteCarloSettings settings_;
+    BlackScholesEngine bs_engine_;
+    
+    void simulate_block(
+        const OptionSpec& spec,
+        double volatility,
+        const PathPayoff& payoff,
+        size_t first_sample,
+        size_t num_samples,
+        Moments& moments
+    ) const;
+};
+
+}
@@ -1,18 +1,61 @@
 #pragma once
 
+#include <cmath>
+#include <cstddef>
+
 namespace implied_vol {
 
-class NormalDistribution {
+template <typename Scalar>
+class BasicNormalDistribution {
 public:
-    static double cdf(double x);
+    static Scalar cdf(const Scalar& x);
+    
+    static Scalar pdf(const Scalar& x);
     
-    static double pdf(double x);
+    static double inverse_cdf(double p);
+    
+    static void inverse_cdf(const double* p, double* out, size_t count);
     
 private:
     static constexpr double INV_SQRT_2PI = 0.3989422804014327;
     static constexpr double SQRT_2 = 1.4142135623730951;
     
-    static double erf_approx(double x);
+    static Scalar erf_approx(const Scalar& x);
 };
 
+template <typename Scalar>
+Scalar BasicNormalDistribution<Scalar>::erf_approx(const Scalar& x) {
+    using std::exp;
+    
+    constexpr double a1 =  0.254829592;
+    constexpr double a2 = -0.284496736;
+    constexpr double a3 =  1.421413741;
+    constexpr double a4 = -1.453152027;
+    constexpr double a5 =  1.061405429;
+    constexpr double p  =  0.3275911;
+    
+    double sign = (x >= 0) ? 1.0 : -1.0;
+    Scalar z = sign * x;
+    
+    Scalar t = 1.0 / (1.0 + p * z);
+    Scalar y = 1.0 - (((((a5 * t + a4) * t) + a3) * t + a2) * t + a1) * t * exp(-z * z);
+    
+    return sign * y;
+}
+
+template <typename Scalar>
+Scalar BasicNormalDistribution<Scalar>::cdf(const Scalar& x) {
+    return 0.5 * (1.0 + erf_approx(x / SQRT_2));
+}
+
+template <typename Scalar>
+Scalar BasicNormalDistribution<Scalar>::pdf(const Scalar& x) {
+    using std::exp;
+    return INV_SQRT_2PI * exp(-0.5 * x * x);
+}
+
+extern template class BasicNormalDistribution<double>;
+
+using NormalDistribution = BasicNormalDistribution<double>;
+
 }
@@ -10,17 +10,28 @@ enum class OptionType {
     PUT
 };
 
-struct OptionSpec {
-    double spot;
-    double strike;
-    double time_to_expiry;
-    double risk_free_rate;
+template <typename Scalar>
+struct BasicOptionSpec {
+    Scalar spot;
+    Scalar strike;
+    Scalar time_to_expiry;
+    Scalar risk_free_rate;
     OptionType type;
     
-    OptionSpec(double S, double K, double T, double r, OptionType opt_type)
+    BasicOptionSpec(const Scalar& S, const Scalar& K, const Scalar& T, const Scalar& r, OptionType opt_type)
         : spot(S), strike(K), time_to_expiry(T), risk_free_rate(r), type(opt_type) {}
 };
 
+using OptionSpec = BasicOptionSpec<double>;
+
+template <typename Scalar>
+struct BasicPriceVega {
+    Scalar price;
+    Scalar vega;
+};
+
+using PriceVega = BasicPriceVega<double>;
+
 enum class ConvergenceStatus {
     SUCCESS,
     MAX_ITERATIONS_REACHED,
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace implied_vol {
+namespace detail {
+
+template <typename F>
+void parallel_for(size_t count, unsigned num_threads, F&& body, size_t min_chunk = 1) {
+    if (num_threads == 0) {
+        num_threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    size_t threads = std::min<size_t>(num_threads, std::max<size_t>(1, count / std::max<size_t>(1, min_chunk)));
+    
+    if (threads <= 1) {
+        body(size_t(0), count);
+        return;
+    }
+    
+    size_t chunk = (count + threads - 1) / threads;
+    std::vector<std::exception_ptr> errors(threads);
+    std::vector<std::thread> pool;
+    pool.reserve(threads);
+    
+    for (size_t t = 0; t < threads; ++t) {
+        size_t begin = t * chunk;
+        size_t end = std::min(count, begin + chunk);
+        if (begin >= end) {
+            break;
+        }
+        pool.emplace_back([&body, &errors, t, begin, end] {
+            try {
+                body(begin, end);
+            } catch (...) {
+                errors[t] = std::current_exception();
+            }
+        });
+    }
+    
+    for (auto& thread : pool) {
+        thread.join();
+    }
+    
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+}
+}
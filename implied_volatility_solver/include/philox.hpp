@@ -0,0 +1,41 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace implied_vol {
+
+class Philox4x32 {
+public:
+    using Counter = std::array<uint32_t, 4>;
+    using Key = std::array<uint32_t, 2>;
+    
+    static constexpr int ROUNDS = 10;
+    
+    explicit Philox4x32(uint64_t seed)
+        : key_{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)} {}
+    
+    Counter operator()(Counter counter) const;
+    
+    void uniforms(uint64_t stream, uint64_t offset, double* out, size_t count) const;
+    
+    void normals(uint64_t stream, uint64_t offset, double* out, size_t count) const;
+    
+    void uniforms_interleaved(uint64_t first_stream, size_t num_streams, double* out, size_t count) const;
+    
+    void normals_interleaved(uint64_t first_stream, size_t num_streams, double* out, size_t count) const;
+    
+    static double to_uniform(uint32_t x) {
+        return (static_cast<double>(x) + 0.5) * (1.0 / 4294967296.0);
+    }
+    
+private:
+    static constexpr size_t BATCH = 16;
+    
+    Key key_;
+    
+    void interleaved(uint64_t first_stream, size_t num_streams, double* out, size_t count, bool normal) const;
+};
+
+}
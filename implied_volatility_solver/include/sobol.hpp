@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace implied_vol {
+
+class SobolSequence {
+public:
+    static constexpr size_t MAX_DIMENSION = 256;
+    static constexpr size_t BITS = 32;
+    
+    explicit SobolSequence(size_t dimension, uint64_t start_index = 0);
+    
+    void skip_to(uint64_t index);
+    
+    void next(double* out);
+    
+    void next_normals(double* out);
+    
+    size_t dimension() const { return dimension_; }
+    uint64_t index() const { return index_; }
+    
+private:
+    size_t dimension_;
+    uint64_t index_;
+    std::vector<uint32_t> directions_;
+    std::vector<uint32_t> state_;
+};
+
+class BrownianBridge {
+public:
+    explicit BrownianBridge(size_t num_steps);
+    
+    explicit BrownianBridge(const std::vector<double>& times);
+    
+    void build_increments(const double* normals, double* increments) const;
+    
+    size_t size() const { return bridge_index_.size(); }
+    
+private:
+    std::vector<size_t> bridge_index_;
+    std::vector<size_t> left_index_;
+    std::vector<size_t> right_index_;
+    std::vector<double> left_weight_;
+    std::vector<double> right_weight_;
+    std::vector<double> std_dev_;
+};
+
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "option_types.hpp"
+#include <cstddef>
+#include <vector>
+
+namespace implied_vol {
+
+struct SVIParameters {
+    double a;
+    double b;
+    double rho;
+    double m;
+    double sigma;
+    
+    SVIParameters(double level = 0.0, double slope = 0.0, double correlation = 0.0,
+                  double shift = 0.0, double curvature = 0.1)
+        : a(level), b(slope), rho(correlation), m(shift), sigma(curvature) {}
+    
+    double total_variance(double log_moneyness) const;
+    
+    double implied_vol(double log_moneyness, double time_to_expiry) const;
+};
+
+struct SSVIParameters {
+    double rho;
+    double eta;
+    double gamma;
+    std::vector<double> expiries;
+    std::vector<double> atm_variances;
+    
+    SSVIParameters(double correlation = -0.3, double scale = 1.0, double exponent = 0.25)
+        : rho(correlation), eta(scale), gamma(exponent) {}
+    
+    double atm_variance(double time_to_expiry) const;
+    
+    double total_variance(double log_moneyness, double time_to_expiry) const;
+    
+    double implied_vol(double log_moneyness, double time_to_expiry) const;
+};
+
+struct SmileSlice {
+    double time_to_expiry;
+    double forward;
+    VolSmile smile;
+    
+    SmileSlice(double T, double F, const VolSmile& vol_smile)
+        : time_to_expiry(T), forward(F), smile(vol_smile) {}
+};
+
+struct SVIFit {
+    SVIParameters parameters;
+    double rms_error;
+    int iterations;
+};
+
+struct SSVIFit {
+    SSVIParameters parameters;
+    double rms_error;
+    int iterations;
+};
+
+class SVICalibrator {
+public:
+    SVIFit fit_slice(const SmileSlice& slice) const;
+    
+    SVIFit fit_slice(const SmileSlice& slice, const SVIParameters& warm_start) const;
+    
+    std::vector<SVIFit> fit_slices(
+        const std::vector<SmileSlice>& slices,
+        const std::vector<SVIParameters>& previous = {},
+        unsigned num_threads = 0
+    ) const;
+    
+    SSVIFit fit_surface(const std::vector<SmileSlice>& slices) const;
+    
+    SSVIFit fit_surface(const std::vector<SmileSlice>& slices, const SSVIParameters& warm_start) const;
+    
+    std::vector<SSVIFit> fit_universe(
+        const std::vector<std::vector<SmileSlice>>& universe,
+        const std::vector<SSVIParameters>& previous = {},
+        unsigned num_threads = 0
+    ) const;
+    
+private:
+    static constexpr int MAX_ITERATIONS = 400;
+    static constexpr double TOLERANCE = 1e-14;
+    static constexpr double COLD_STEP = 0.1;
+    static constexpr double WARM_STEP = 0.01;
+    
+    SVIFit fit_slice_from(const SmileSlice& slice, const SVIParameters& start, double step) const;
+    
+    SSVIFit fit_surface_from(
+        const std::vector<SmileSlice>& slices,
+        const SSVIParameters& start,
+        double step
+    ) const;
+};
+
+}
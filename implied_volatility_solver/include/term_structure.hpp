@@ -0,0 +1,57 @@
+#pragma once
+
+#include "implied_vol_solver.hpp"
+#include "option_types.hpp"
+#include "yield_curve.hpp"
+#include <cstddef>
+#include <vector>
+
+namespace implied_vol {
+
+class ExpiryTermStructure {
+public:
+    ExpiryTermStructure(
+        const yield_curve::YieldCurve& curve,
+        double spot,
+        const std::vector<double>& expiries
+    );
+    
+    size_t size() const { return expiries_.size(); }
+    
+    double spot() const { return spot_; }
+    
+    const std::vector<double>& expiries() const { return expiries_; }
+    
+    double discount_factor(size_t expiry_index) const { return discount_factors_.at(expiry_index); }
+    double forward(size_t expiry_index) const { return forwards_.at(expiry_index); }
+    double rate(size_t expiry_index) const { return rates_.at(expiry_index); }
+    
+    size_t index_of(double expiry) const;
+    
+    OptionSpec make_spec(size_t expiry_index, double strike, OptionType type) const;
+    
+    VolSmile compute_vol_smile(
+        ImpliedVolSolver& solver,
+        size_t expiry_index,
+        const std::vector<double>& strikes,
+        const std::vector<double>& market_prices,
+        OptionType type = OptionType::CALL
+    ) const;
+    
+    std::vector<ImpliedVolResult> solve_batch(
+        ImpliedVolSolver& solver,
+        const std::vector<size_t>& expiry_indices,
+        const std::vector<double>& strikes,
+        const std::vector<double>& market_prices,
+        const std::vector<OptionType>& types
+    ) const;
+    
+private:
+    double spot_;
+    std::vector<double> expiries_;
+    std::vector<double> discount_factors_;
+    std::vector<double> forwards_;
+    std::vector<double> rates_;
+};
+
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "svi.hpp"
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace implied_vol {
+
+enum class SurfaceInterpolation {
+    BILINEAR,
+    CUBIC
+};
+
+class VolSurface {
+public:
+    static constexpr size_t ALIGNMENT = 64;
+    
+    VolSurface(
+        double min_log_moneyness,
+        double max_log_moneyness,
+        size_t num_log_moneyness,
+        const std::vector<double>& expiries,
+        const std::vector<double>& total_variances,
+        SurfaceInterpolation interpolation = SurfaceInterpolation::BILINEAR
+    );
+    
+    static VolSurface from_ssvi(
+        const SSVIParameters& params,
+        double min_log_moneyness,
+        double max_log_moneyness,
+        size_t num_log_moneyness,
+        SurfaceInterpolation interpolation = SurfaceInterpolation::BILINEAR
+    );
+    
+    static VolSurface from_svi(
+        const std::vector<double>& expiries,
+        const std::vector<SVIParameters>& slices,
+        double min_log_moneyness,
+        double max_log_moneyness,
+        size_t num_log_moneyness,
+        SurfaceInterpolation interpolation = SurfaceInterpolation::BILINEAR
+    );
+    
+    double total_variance(double log_moneyness, double time_to_expiry) const;
+    
+    double implied_vol(double log_moneyness, double time_to_expiry) const;
+    
+    std::vector<double> implied_vols(
+        const std::vector<double>& log_moneyness,
+        const std::vector<double>& expiries
+    ) const;
+    
+    void implied_vols(
+        const double* log_moneyness,
+        const double* expiries,
+        double* out,
+        size_t count
+    ) const;
+    
+    size_t num_log_moneyness() const { return grid_->num_k; }
+    size_t num_expiries() const { return grid_->expiries.size(); }
+    const std::vector<double>& expiries() const { return grid_->expiries; }
+    SurfaceInterpolation interpolation() const { return grid_->interpolation; }
+    
+    const double* data() const { return grid_->values.get(); }
+    
+private:
+    struct AlignedDeleter {
+        void operator()(double* p) const;
+    };
+    
+    using AlignedArray = std::unique_ptr<double[], AlignedDeleter>;
+    
+    struct Grid {
+        double k_min;
+        double inv_dk;
+        size_t num_k;
+        std::vector<double> expiries;
+        std::vector<size_t> buckets;
+        double bucket_scale;
+        AlignedArray values;
+        AlignedArray coefficients;
+        SurfaceInterpolation interpolation;
+    };
+    
+    std::shared_ptr<const Grid> grid_;
+    
+    static AlignedArray allocate(size_t count);
+    
+    double row_variance(size_t row, double log_moneyness) const;
+};
+
+}
@@ -0,0 +1,206 @@
+#include "american_approximation.hpp"
+#include "normal_distribution.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace implied_vol {
+
+template class BasicImpliedVolSolver<AmericanApproximationEngine>;
+
+namespace {
+
+struct ExerciseTerms {
+    double alpha;
+    double beta;
+    double h;
+    double root;
+    double lambda;
+};
+
+ExerciseTerms exercise_terms(const OptionSpec& spec, double volatility) {
+    ExerciseTerms terms;
+    double variance = volatility * volatility;
+    terms.alpha = 2.0 * spec.risk_free_rate / variance;
+    terms.beta = terms.alpha;
+    terms.h = 1.0 - std::exp(-spec.risk_free_rate * spec.time_to_expiry);
+    terms.root = std::sqrt((terms.beta - 1.0) * (terms.beta - 1.0) + 4.0 * terms.alpha / terms.h);
+    terms.lambda = 0.5 * (-(terms.beta - 1.0) - terms.root);
+    return terms;
+}
+
+}
+
+double AmericanApproximationEngine::intrinsic_value(const OptionSpec& spec) const {
+    return bs_engine_.intrinsic_value(spec);
+}
+
+double AmericanApproximationEngine::solve_critical(
+    const OptionSpec& spec,
+    double volatility,
+    double guess
+) const {
+    ExerciseTerms terms = exercise_terms(spec, volatility);
+    double K = spec.strike;
+    double sqrt_T = std::sqrt(spec.time_to_expiry);
+    double sigma_sqrt_T = volatility * sqrt_T;
+    double discount = std::exp(-spec.risk_free_rate * spec.time_to_expiry);
+    double drift = (spec.risk_free_rate + 0.5 * volatility * volatility) * spec.time_to_expiry;
+    
+    double s = guess;
+    if (!(s > 0.0 && s < K)) {
+        double root_inf = std::sqrt((terms.beta - 1.0) * (terms.beta - 1.0) + 4.0 * terms.alpha);
+        double lambda_inf = 0.5 * (-(terms.beta - 1.0) - root_inf);
+        double s_inf = K / (1.0 - 1.0 / lambda_inf);
+        double h2 = (spec.risk_free_rate * spec.time_to_expiry - 2.0 * sigma_sqrt_T) * K / (K - s_inf);
+        s = s_inf + (K - s_inf) * std::exp(h2);
+    }
+    
+    for (int iter = 0; iter < MAX_CRITICAL_ITERATIONS; ++iter) {
+        double d1 = (std::log(s / K) + drift) / sigma_sqrt_T;
+        double d2 = d1 - sigma_sqrt_T;
+        double n_minus_d1 = NormalDistribution::cdf(-d1);
+        double put = K * discount * NormalDistribution::cdf(-d2) - s * n_minus_d1;
+        
+        double g = K - s - put + (1.0 - n_minus_d1) * s / terms.lambda;
+        double dg = -1.0 + n_minus_d1 + (1.0 - n_minus_d1) / terms.lambda +
+                    NormalDistribution::pdf(d1) / (sigma_sqrt_T * terms.lambda);
+        
+        double step = g / dg;
+        double next = s - step;
+        if (next <= 0.0) {
+            next = 0.5 * s;
+        } else if (next >= K) {
+            next = 0.5 * (s + K);
+        }
+        
+        if (std::abs(next - s) < CRITICAL_TOLERANCE * K) {
+            return next;
+        }
+        s = next;
+    }
+    
+    return s;
+}
+
+double AmericanApproximationEngine::critical_price(const OptionSpec& spec, double volatility) const {
+    if (spec.type == OptionType::CALL || spec.risk_free_rate <= 0.0) {
+        return 0.0;
+    }
+    return solve_critical(spec, volatility, 0.0);
+}
+
+PriceVega AmericanApproximationEngine::price_put(
+    const OptionSpec& spec,
+    double volatility,
+    double& critical
+) const {
+    critical = solve_critical(spec, volatility, critical);
+    
+    double S = spec.spot;
+    double K = spec.strike;
+    double r = spec.risk_free_rate;
+    double T = spec.time_to_expiry;
+    double sqrt_T = std::sqrt(T);
+    double sigma_sqrt_T = volatility * sqrt_T;
+    double discount = std::exp(-r * T);
+    double drift = (r + 0.5 * volatility * volatility) * T;
+    
+    double d1 = (std::log(S / K) + drift) / sigma_sqrt_T;
+    double d2 = d1 - sigma_sqrt_T;
+    double european = K * discount * NormalDistribution::cdf(-d2) - S * NormalDistribution::cdf(-d1);
+    double european_vega = S * NormalDistribution::pdf(d1) * sqrt_T;
+    
+    if (S <= critical) {
+        return {K - S, 0.0};
+    }
+    
+    // The early-exercise premium is stationary in the critical price, so its
+    // vega holds the critical price fixed.
+    ExerciseTerms terms = exercise_terms(spec, volatility);
+    double alpha_v = -2.0 * terms.alpha / volatility;
+    double root_v = alpha_v * (terms.beta - 1.0 + 2.0 / terms.h) / terms.root;
+    double lambda_v = -0.5 * (alpha_v + root_v);
+    
+    double d1_c = (std::log(critical / K) + drift) / sigma_sqrt_T;
+    double d2_c = d1_c - sigma_sqrt_T;
+    double pdf_c = NormalDistribution::pdf(d1_c);
+    double n_minus_d1_c = NormalDistribution::cdf(-d1_c);
+    double n_minus_d2_c = NormalDistribution::cdf(-d2_c);
+    double european_boundary = K * discount * n_minus_d2_c - critical * n_minus_d1_c;
+    
+    double premium = K - critical - european_boundary;
+    double premium_v = -critical * pdf_c * sqrt_T;
+    double log_ratio = std::log(S / critical);
+    double ratio = std::pow(S / critical, terms.lambda);
+    double ratio_v = ratio * log_ratio * lambda_v;
+    double exercise = premium * ratio;
+    double exercise_v = premium_v * ratio + premium * ratio_v;
+    
+    if (method_ == AmericanApproximation::BARONE_ADESI_WHALEY) {
+        return {european + exercise, european_vega + exercise_v};
+    }
+    
+    double growth = std::exp(r * T) / r;
+    double dP_dT = critical * pdf_c * volatility / (2.0 * sqrt_T) - r * K * discount * n_minus_d2_c;
+    double dP_dT_v = critical * pdf_c * ((1.0 + d1_c * d2_c) / (2.0 * sqrt_T) - r * d1_c / volatility);
+    double dP_dh = dP_dT * growth;
+    double dP_dh_v = dP_dT_v * growth;
+    
+    double denom = 2.0 * terms.lambda + terms.beta - 1.0;
+    double denom_v = 2.0 * lambda_v + alpha_v;
+    double lambda_h = terms.alpha / (terms.h * terms.h * terms.root);
+    double lambda_h_v = lambda_h * (alpha_v / terms.alpha - root_v / terms.root);
+    
+    double weight = (1.0 - terms.h) * terms.alpha / denom;
+    double weight_v = (1.0 - terms.h) * (alpha_v - terms.alpha * denom_v / denom) / denom;
+    double slope = dP_dh / premium + 1.0 / terms.h + lambda_h / denom;
+    double slope_v = (dP_dh_v - dP_dh * premium_v / premium) / premium +
+                     (lambda_h_v - lambda_h * denom_v / denom) / denom;
+    
+    double b = 0.5 * weight * lambda_h;
+    double b_v = 0.5 * (weight_v * lambda_h + weight * lambda_h_v);
+    double c = -weight * slope;
+    double c_v = -(weight_v * slope + weight * slope_v);
+    
+    // The correction term is not stationary in the critical price, so it
+    // also picks up the critical price's own volatility sensitivity.
+    double premium_s = n_minus_d1_c - 1.0;
+    double dP_dh_s = pdf_c * (r / sigma_sqrt_T - 0.5 * d2_c / T) * growth;
+    double c_s = -weight * (dP_dh_s - dP_dh * premium_s / premium) / premium;
+    double g_s = premium_s + (1.0 - n_minus_d1_c) / terms.lambda +
+                 pdf_c / (sigma_sqrt_T * terms.lambda);
+    double g_v = premium_v - critical / terms.lambda *
+                 (pdf_c * d2_c / volatility + (1.0 - n_minus_d1_c) * lambda_v / terms.lambda);
+    double critical_v = -g_v / g_s;
+    
+    double chi = b * log_ratio * log_ratio + c * log_ratio;
+    double chi_s = c_s * log_ratio - (2.0 * b * log_ratio + c) / critical;
+    double chi_v = b_v * log_ratio * log_ratio + c_v * log_ratio + chi_s * critical_v;
+    double scale = 1.0 / (1.0 - chi);
+    
+    return {european + exercise * scale,
+            european_vega + (exercise_v + exercise * chi_v * scale) * scale};
+}
+
+double AmericanApproximationEngine::price(const OptionSpec& spec, double volatility) const {
+    if (spec.type == OptionType::CALL || spec.risk_free_rate <= 0.0) {
+        return bs_engine_.price(spec, volatility);
+    }
+    double critical = 0.0;
+    return price_put(spec, volatility, critical).price;
+}
+
+double AmericanApproximationEngine::vega(const OptionSpec& spec, double volatility) const {
+    return price_and_vega(spec, volatility).vega;
+}
+
+PriceVega AmericanApproximationEngine::price_and_vega(const OptionSpec& spec, double volatility) const {
+    if (spec.type == OptionType::CALL || spec.risk_free_rate <= 0.0) {
+        return bs_engine_.price_and_vega(spec, volatility);
+    }
+    
+    double critical = 0.0;
+    return price_put(spec, volatility, critical);
+}
+
+}
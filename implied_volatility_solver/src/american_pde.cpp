@@ -0,0 +1,320 @@
+#include "american_pde.hpp"
+#include "implied_vol_solver.hpp"
+#include "parallel.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace implied_vol {
+
+void TridiagonalSolver::factor(double lower, double diag, double upper, size_t size) {
+    if (size == 0) {
+        throw std::invalid_argument("Tridiagonal system must not be empty");
+    }
+    
+    lower_ = lower;
+    upper_ = upper;
+    size_ = size;
+    down_pivot_.resize(size);
+    up_pivot_.resize(size);
+    scratch_.resize(size);
+    
+    down_pivot_[0] = 1.0 / diag;
+    for (size_t i = 1; i < size; ++i) {
+        down_pivot_[i] = 1.0 / (diag - lower * upper * down_pivot_[i - 1]);
+    }
+    
+    up_pivot_[size - 1] = 1.0 / diag;
+    for (size_t i = size - 1; i-- > 0;) {
+        up_pivot_[i] = 1.0 / (diag - upper * lower * up_pivot_[i + 1]);
+    }
+}
+
+void TridiagonalSolver::solve(const double* rhs, double* out) const {
+    double* d = scratch_.data();
+    d[0] = rhs[0] * down_pivot_[0];
+    for (size_t i = 1; i < size_; ++i) {
+        d[i] = (rhs[i] - lower_ * d[i - 1]) * down_pivot_[i];
+    }
+    
+    out[size_ - 1] = d[size_ - 1];
+    for (size_t i = size_ - 1; i-- > 0;) {
+        out[i] = d[i] - upper_ * down_pivot_[i] * out[i + 1];
+    }
+}
+
+void TridiagonalSolver::solve_projected(
+    const double* rhs,
+    const double* obstacle,
+    bool exercise_low,
+    double* out
+) const {
+    double* d = scratch_.data();
+    
+    if (!exercise_low) {
+        d[0] = rhs[0] * down_pivot_[0];
+        for (size_t i = 1; i < size_; ++i) {
+            d[i] = (rhs[i] - lower_ * d[i - 1]) * down_pivot_[i];
+        }
+        
+        out[size_ - 1] = std::max(d[size_ - 1], obstacle[size_ - 1]);
+        for (size_t i = size_ - 1; i-- > 0;) {
+            out[i] = std::max(d[i] - upper_ * down_pivot_[i] * out[i + 1], obstacle[i]);
+        }
+        return;
+    }
+    
+    d[size_ - 1] = rhs[size_ - 1] * up_pivot_[size_ - 1];
+    for (size_t i = size_ - 1; i-- > 0;) {
+        d[i] = (rhs[i] - upper_ * d[i + 1]) * up_pivot_[i];
+    }
+    
+    out[0] = std::max(d[0], obstacle[0]);
+    for (size_t i = 1; i < size_; ++i) {
+        out[i] = std::max(d[i] - lower_ * up_pivot_[i] * out[i - 1], obstacle[i]);
+    }
+}
+
+AmericanPDEEngine::AmericanPDEEngine(size_t space_steps, size_t time_steps, ExerciseStyle style)
+    : space_steps_(space_steps + (space_steps % 2)), time_steps_(time_steps), style_(style) {
+    if (space_steps < 4) {
+        throw std::invalid_argument("PDE grid needs at least four space steps");
+    }
+    
+    if (time_steps < SMOOTHING_STEPS / 2 + 1) {
+        throw std::invalid_argument("PDE grid needs more time steps");
+    }
+}
+
+double AmericanPDEEngine::price(const OptionSpec& spec, double volatility) const {
+    Workspace workspace;
+    return price(spec, volatility, workspace);
+}
+
+double AmericanPDEEngine::price(const OptionSpec& spec, double volatility, Workspace& ws) const {
+    if (spec.spot <= 0 || spec.strike <= 0 || spec.time_to_expiry <= 0) {
+        throw std::invalid_argument("Spot, strike and time to expiry must be positive");
+    }
+    
+    if (volatility <= 0) {
+        throw std::invalid_argument("Volatility must be positive");
+    }
+    
+    const size_t n = space_steps_;
+    const size_t interior = n - 1;
+    const double T = spec.time_to_expiry;
+    const double r = spec.risk_free_rate;
+    const double K = spec.strike;
+    const bool is_put = spec.type == OptionType::PUT;
+    const bool american = style_ == ExerciseStyle::AMERICAN;
+    
+    double half_width = NUM_STD_DEVS * volatility * std::sqrt(T) + std::abs(std::log(K / spec.spot));
+    double dx = 2.0 * half_width / n;
+    double x0 = std::log(spec.spot) - 0.5 * n * dx;
+    
+    ws.spots.resize(n + 1);
+    ws.values.resize(n + 1);
+    ws.payoff.resize(n + 1);
+    ws.rhs.resize(interior);
+    
+    for (size_t j = 0; j <= n; ++j) {
+        double s = std::exp(x0 + j * dx);
+        ws.spots[j] = s;
+        ws.payoff[j] = is_put ? std::max(K - s, 0.0) : std::max(s - K, 0.0);
+        ws.values[j] = ws.payoff[j];
+    }
+    
+    double alpha = 0.5 * volatility * volatility / (dx * dx);
+    double beta = (r - 0.5 * volatility * volatility) / (2.0 * dx);
+    double lower = alpha - beta;
+    double diag = -2.0 * alpha - r;
+    double upper = alpha + beta;
+    
+    double dt = T / time_steps_;
+    double dt_implicit = dt / 2.0;
+    double dt_cn = dt / 2.0;
+    
+    ws.implicit.factor(-dt_implicit * lower, 1.0 - dt_implicit * diag, -dt_implicit * upper, interior);
+    ws.crank_nicolson.factor(-dt_cn * lower, 1.0 - dt_cn * diag, -dt_cn * upper, interior);
+    
+    auto boundaries = [&](double tau, double& low, double& high) {
+        double df = std::exp(-r * tau);
+        if (is_put) {
+            low = american ? K - ws.spots[0] : K * df - ws.spots[0];
+            high = 0.0;
+        } else {
+            low = 0.0;
+            high = ws.spots[n] - K * df;
+        }
+    };
+    
+    size_t cn_steps = time_steps_ - SMOOTHING_STEPS / 2;
+    size_t total_steps = SMOOTHING_STEPS + cn_steps;
+    double tau = 0.0;
+    
+    for (size_t step = 0; step < total_steps; ++step) {
+        bool smoothing = step < SMOOTHING_STEPS;
+        double h = smoothing ? dt_implicit : dt;
+        double w = smoothing ? dt_implicit : dt_cn;
+        tau += h;
+        
+        const double* v = ws.values.data();
+        for (size_t i = 0; i < interior; ++i) {
+            size_t j = i + 1;
+            ws.rhs[i] = smoothing
+                ? v[j]
+                : v[j] + dt_cn * (lower * v[j - 1] + diag * v[j] + upper * v[j + 1]);
+        }
+        
+        double low = 0.0;
+        double high = 0.0;
+        boundaries(tau, low, high);
+        ws.rhs[0] += w * lower * low;
+        ws.rhs[interior - 1] += w * upper * high;
+        
+        const TridiagonalSolver& solver = smoothing ? ws.implicit : ws.crank_nicolson;
+        if (american) {
+            solver.solve_projected(ws.rhs.data(), ws.payoff.data() + 1, is_put, ws.values.data() + 1);
+        } else {
+            solver.solve(ws.rhs.data(), ws.values.data() + 1);
+        }
+        ws.values[0] = low;
+        ws.values[n] = high;
+    }
+    
+    return ws.values[n / 2];
+}
+
+std::vector<double> AmericanPDEEngine::price_batch(
+    const std::vector<OptionSpec>& specs,
+    const std::vector<double>& volatilities,
+    unsigned num_threads
+) const {
+    if (specs.size() != volatilities.size()) {
+        throw std::invalid_argument("Specs and volatilities must have the same size");
+    }
+    
+    for (size_t i = 0; i < specs.size(); ++i) {
+        const OptionSpec& spec = specs[i];
+        if (spec.spot <= 0 || spec.strike <= 0 || spec.time_to_expiry <= 0 || volatilities[i] <= 0) {
+            throw std::invalid_argument("Spot, strike, expiry and volatility must be positive");
+        }
+    }
+    
+    std::vector<double> prices(specs.size());
+    detail::parallel_for(specs.size(), num_threads, [&](size_t begin, size_t end) {
+        Workspace workspace;
+        for (size_t i = begin; i < end; ++i) {
+            prices[i] = price(specs[i], volatilities[i], workspace);
+        }
+    });
+    return prices;
+}
+
+ImpliedVolResult AmericanPDEEngine::implied_vol(
+    const OptionSpec& spec,
+    double market_price,
+    double tolerance,
+    int max_iterations
+) const {
+    Workspace workspace;
+    return implied_vol(spec, market_price, workspace, tolerance, max_iterations);
+}
+
+ImpliedVolResult AmericanPDEEngine::implied_vol(
+    const OptionSpec& spec,
+    double market_price,
+    Workspace& workspace,
+    double tolerance,
+    int max_iterations
+) const {
+    if (spec.spot <= 0 || spec.strike <= 0 || spec.time_to_expiry <= 0 || market_price <= 0) {
+        return ImpliedVolResult(0.0, 0, 0.0, ConvergenceStatus::INVALID_INPUT);
+    }
+    
+    bool is_put = spec.type == OptionType::PUT;
+    double discounted_strike = spec.strike * std::exp(-spec.risk_free_rate * spec.time_to_expiry);
+    double lower_bound = is_put
+        ? (style_ == ExerciseStyle::AMERICAN ? spec.strike - spec.spot : discounted_strike - spec.spot)
+        : spec.spot - discounted_strike;
+    double upper_bound = is_put
+        ? (style_ == ExerciseStyle::AMERICAN ? spec.strike : discounted_strike)
+        : spec.spot;
+    
+    if (market_price <= std::max(lower_bound, 0.0) || market_price >= upper_bound) {
+        return ImpliedVolResult(0.0, 0, 0.0, ConvergenceStatus::PRICE_OUT_OF_BOUNDS);
+    }
+    
+    ImpliedVolSolver european;
+    ImpliedVolResult warm = european.solve_with_fallback(spec, market_price);
+    double vol_a = warm.is_success() ? std::clamp(warm.implied_vol, VOL_MIN, VOL_MAX) : 0.2;
+    
+    double lo = VOL_MIN;
+    double hi = VOL_MAX;
+    int iterations = 0;
+    
+    auto evaluate = [&](double vol) {
+        ++iterations;
+        double diff = price(spec, vol, workspace) - market_price;
+        if (diff < 0) {
+            lo = std::max(lo, vol);
+        } else {
+            hi = std::min(hi, vol);
+        }
+        return diff;
+    };
+    
+    double f_a = evaluate(vol_a);
+    if (std::abs(f_a) < tolerance) {
+        return ImpliedVolResult(vol_a, iterations, std::abs(f_a), ConvergenceStatus::SUCCESS);
+    }
+    
+    double vol_b = std::clamp(vol_a * (f_a > 0 ? 0.97 : 1.03), VOL_MIN, VOL_MAX);
+    double f_b = evaluate(vol_b);
+    
+    while (iterations < max_iterations) {
+        if (std::abs(f_b) < tolerance) {
+            return ImpliedVolResult(vol_b, iterations, std::abs(f_b), ConvergenceStatus::SUCCESS);
+        }
+        
+        double next = (f_b != f_a) ? vol_b - f_b * (vol_b - vol_a) / (f_b - f_a) : 0.5 * (lo + hi);
+        if (!std::isfinite(next) || next <= lo || next >= hi) {
+            next = 0.5 * (lo + hi);
+        }
+        
+        if (std::abs(next - vol_b) < 1e-12) {
+            return ImpliedVolResult(vol_b, iterations, std::abs(f_b), ConvergenceStatus::SUCCESS);
+        }
+        
+        vol_a = vol_b;
+        f_a = f_b;
+        vol_b = next;
+        f_b = evaluate(vol_b);
+    }
+    
+    ConvergenceStatus status = (std::abs(f_b) < tolerance)
+        ? ConvergenceStatus::SUCCESS
+        : ConvergenceStatus::MAX_ITERATIONS_REACHED;
+    return ImpliedVolResult(vol_b, iterations, std::abs(f_b), status);
+}
+
+std::vector<ImpliedVolResult> AmericanPDEEngine::implied_vol_batch(
+    const std::vector<OptionSpec>& specs,
+    const std::vector<double>& market_prices,
+    unsigned num_threads
+) const {
+    if (specs.size() != market_prices.size()) {
+        return {};
+    }
+    
+    std::vector<ImpliedVolResult> results(specs.size());
+    detail::parallel_for(specs.size(), num_threads, [&](size_t begin, size_t end) {
+        Workspace workspace;
+        for (size_t i = begin; i < end; ++i) {
+            results[i] = implied_vol(specs[i], market_prices[i], workspace);
+        }
+    });
+    return results;
+}
+
+}
@@ -0,0 +1,366 @@
+#include "heston.hpp"
+#include "parallel.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <map>
+#include <stdexcept>
+#include <utility>
+
+namespace implied_vol {
+
+namespace {
+
+constexpr double PI = 3.14159265358979323846;
+
+constexpr std::array<double, 5> LOWER_BOUNDS = {1e-4, 1e-3, 1e-4, 1e-3, -0.999};
+constexpr std::array<double, 5> UPPER_BOUNDS = {2.0, 20.0, 2.0, 5.0, 0.999};
+
+HestonParameters to_parameters(const double* x) {
+    return HestonParameters(x[0], x[1], x[2], x[3], x[4]);
+}
+
+void project(double* x) {
+    for (size_t j = 0; j < LOWER_BOUNDS.size(); ++j) {
+        x[j] = std::clamp(x[j], LOWER_BOUNDS[j], UPPER_BOUNDS[j]);
+    }
+}
+
+bool solve_linear_system(std::array<std::array<double, 5>, 5> a, std::array<double, 5>& b) {
+    const size_t n = b.size();
+    for (size_t col = 0; col < n; ++col) {
+        size_t pivot = col;
+        for (size_t row = col + 1; row < n; ++row) {
+            if (std::abs(a[row][col]) > std::abs(a[pivot][col])) {
+                pivot = row;
+            }
+        }
+        if (std::abs(a[pivot][col]) < 1e-300) {
+            return false;
+        }
+        std::swap(a[col], a[pivot]);
+        std::swap(b[col], b[pivot]);
+        
+        for (size_t row = col + 1; row < n; ++row) {
+            double factor = a[row][col] / a[col][col];
+            for (size_t k = col; k < n; ++k) {
+                a[row][k] -= factor * a[col][k];
+            }
+            b[row] -= factor * b[col];
+        }
+    }
+    
+    for (size_t row = n; row-- > 0;) {
+        double sum = b[row];
+        for (size_t k = row + 1; k < n; ++k) {
+            sum -= a[row][k] * b[k];
+        }
+        b[row] = sum / a[row][row];
+    }
+    return true;
+}
+
+}
+
+bool HestonParameters::is_valid() const {
+    return v0 >= 0.0 && kappa > 0.0 && theta > 0.0 && vol_of_vol > 0.0 &&
+           rho > -1.0 && rho < 1.0;
+}
+
+HestonEngine::HestonEngine(size_t num_terms, double truncation_width)
+    : num_terms_(num_terms), truncation_width_(truncation_width) {
+    if (num_terms < 2) {
+        throw std::invalid_argument("COS expansion needs at least two terms");
+    }
+    if (truncation_width <= 0.0) {
+        throw std::invalid_argument("Truncation width must be positive");
+    }
+}
+
+std::complex<double> HestonEngine::characteristic_function(
+    const HestonParameters& params,
+    double u,
+    double time_to_expiry,
+    double risk_free_rate
+) const {
+    const std::complex<double> i(0.0, 1.0);
+    double xi2 = params.vol_of_vol * params.vol_of_vol;
+    
+    std::complex<double> beta = params.kappa - params.rho * params.vol_of_vol * i * u;
+    std::complex<double> d = std::sqrt(beta * beta + xi2 * (i * u + u * u));
+    std::complex<double> g = (beta - d) / (beta + d);
+    std::complex<double> exp_dt = std::exp(-d * time_to_expiry);
+    
+    std::complex<double> C = params.kappa * params.theta / xi2 *
+        ((beta - d) * time_to_expiry - 2.0 * std::log((1.0 - g * exp_dt) / (1.0 - g)));
+    std::complex<double> D = (beta - d) / xi2 * (1.0 - exp_dt) / (1.0 - g * exp_dt);
+    
+    return std::exp(i * u * risk_free_rate * time_to_expiry + C + D * params.v0);
+}
+
+void HestonEngine::prepare_expiry(
+    const HestonParameters& params,
+    double time_to_expiry,
+    double risk_free_rate,
+    ExpiryTerms& terms
+) const {
+    double T = time_to_expiry;
+    double kappa = params.kappa;
+    double theta = params.theta;
+    double v0 = params.v0;
+    double xi = params.vol_of_vol;
+    double rho = params.rho;
+    double e1 = std::exp(-kappa * T);
+    double e2 = e1 * e1;
+    
+    double c1 = risk_free_rate * T + (1.0 - e1) * (theta - v0) / (2.0 * kappa) - 0.5 * theta * T;
+    double c2 = (xi * T * kappa * e1 * (v0 - theta) * (8.0 * kappa * rho - 4.0 * xi) +
+                 kappa * rho * xi * (1.0 - e1) * (16.0 * theta - 8.0 * v0) +
+                 2.0 * theta * kappa * T * (-4.0 * kappa * rho * xi + xi * xi + 4.0 * kappa * kappa) +
+                 xi * xi * ((theta - 2.0 * v0) * e2 + theta * (6.0 * e1 - 7.0) + 2.0 * v0) +
+                 8.0 * kappa * kappa * (v0 - theta) * (1.0 - e1)) /
+                (8.0 * kappa * kappa * kappa);
+    double width = truncation_width_ * std::sqrt(std::max(std::abs(c2), 1e-8));
+    
+    terms.lower = c1 - width;
+    terms.range = 2.0 * width;
+    terms.weights.resize(num_terms_);
+    terms.frequencies.resize(num_terms_);
+    terms.damping.resize(num_terms_);
+    
+    for (size_t k = 0; k < num_terms_; ++k) {
+        double u = k * PI / terms.range;
+        std::complex<double> phi = characteristic_function(params, u, T, risk_free_rate);
+        std::complex<double> shift(std::cos(u * terms.lower), -std::sin(u * terms.lower));
+        
+        terms.weights[k] = (phi * shift).real() * 2.0 / terms.range;
+        terms.frequencies[k] = u;
+        terms.damping[k] = 1.0 / (1.0 + u * u);
+    }
+    terms.weights[0] *= 0.5;
+}
+
+std::vector<double> HestonEngine::price_strip(
+    const HestonParameters& params,
+    double spot,
+    double time_to_expiry,
+    double risk_free_rate,
+    const std::vector<double>& strikes,
+    OptionType type
+) const {
+    if (!params.is_valid()) {
+        throw std::invalid_argument("Invalid Heston parameters");
+    }
+    if (spot <= 0.0 || time_to_expiry <= 0.0) {
+        throw std::invalid_argument("Spot and time to expiry must be positive");
+    }
+    for (double strike : strikes) {
+        if (strike <= 0.0) {
+            throw std::invalid_argument("Strikes must be positive");
+        }
+    }
+    
+    ExpiryTerms terms;
+    prepare_expiry(params, time_to_expiry, risk_free_rate, terms);
+    
+    double discount = std::exp(-risk_free_rate * time_to_expiry);
+    
+    std::vector<double> prices(strikes.size());
+    for (size_t s = 0; s < strikes.size(); ++s) {
+        double strike = strikes[s];
+        double a = std::log(spot / strike) + terms.lower;
+        double forward_put = strike * discount - spot;
+        
+        double put;
+        if (a >= 0.0) {
+            put = 0.0;
+        } else if (a + terms.range <= 0.0) {
+            put = forward_put;
+        } else {
+            double exp_a = std::exp(a);
+            double angle = -a * PI / terms.range;
+            std::complex<double> step(std::cos(angle), std::sin(angle));
+            std::complex<double> z = step;
+            
+            double sum = terms.weights[0] * (-a - (1.0 - exp_a));
+            for (size_t k = 1; k < num_terms_; ++k) {
+                double u = terms.frequencies[k];
+                double chi = (z.real() - exp_a + u * z.imag()) * terms.damping[k];
+                double psi = z.imag() / u;
+                sum += terms.weights[k] * (psi - chi);
+                z *= step;
+            }
+            put = std::max(0.0, strike * discount * sum);
+        }
+        
+        prices[s] = (type == OptionType::PUT) ? put : std::max(0.0, put - forward_put);
+    }
+    
+    return prices;
+}
+
+double HestonEngine::price(const HestonParameters& params, const OptionSpec& spec) const {
+    return price_strip(params, spec.spot, spec.time_to_expiry, spec.risk_free_rate,
+                       {spec.strike}, spec.type).front();
+}
+
+HestonCalibrator::HestonCalibrator(const HestonEngine& engine, double spot, double risk_free_rate)
+    : engine_(engine), spot_(spot), risk_free_rate_(risk_free_rate) {
+    if (spot <= 0.0) {
+        throw std::invalid_argument("Spot must be positive");
+    }
+}
+
+void HestonCalibrator::residuals(
+    const std::vector<Strip>& strips,
+    const std::vector<HestonQuote>& quotes,
+    const double* x,
+    std::vector<double>& out
+) const {
+    HestonParameters params = to_parameters(x);
+    for (const auto& strip : strips) {
+        std::vector<double> model = engine_.price_strip(
+            params, spot_, strip.time_to_expiry, risk_free_rate_, strip.strikes, strip.type);
+        for (size_t i = 0; i < model.size(); ++i) {
+            size_t q = strip.quote_indices[i];
+            out[q] = model[i] - quotes[q].market_price;
+        }
+    }
+}
+
+HestonCalibrationResult HestonCalibrator::calibrate(
+    const std::vector<HestonQuote>& quotes,
+    const HestonParameters& initial_guess,
+    unsigned num_threads
+) const {
+    if (quotes.empty()) {
+        throw std::invalid_argument("No quotes to calibrate");
+    }
+    
+    std::map<std::pair<double, int>, size_t> strip_index;
+    std::vector<Strip> strips;
+    for (size_t q = 0; q < quotes.size(); ++q) {
+        const HestonQuote& quote = quotes[q];
+        if (quote.time_to_expiry <= 0.0 || quote.strike <= 0.0) {
+            throw std::invalid_argument("Quote expiry and strike must be positive");
+        }
+        auto key = std::make_pair(quote.time_to_expiry, static_cast<int>(quote.type));
+        auto it = strip_index.find(key);
+        if (it == strip_index.end()) {
+            it = strip_index.emplace(key, strips.size()).first;
+            strips.push_back({quote.time_to_expiry, quote.type, {}, {}});
+        }
+        strips[it->second].strikes.push_back(quote.strike);
+        strips[it->second].quote_indices.push_back(q);
+    }
+    
+    const size_t m = quotes.size();
+    std::array<double, NUM_PARAMS> x = {initial_guess.v0, initial_guess.kappa, initial_guess.theta,
+                                        initial_guess.vol_of_vol, initial_guess.rho};
+    project(x.data());
+    
+    std::vector<double> r(m);
+    residuals(strips, quotes, x.data(), r);
+    double cost = 0.0;
+    for (double v : r) {
+        cost += v * v;
+    }
+    
+    std::array<std::vector<double>, NUM_PARAMS> jacobian;
+    for (auto& column : jacobian) {
+        column.resize(m);
+    }
+    
+    auto compute_columns = [&](size_t begin, size_t end) {
+        for (size_t j = begin; j < end; ++j) {
+            std::array<double, NUM_PARAMS> shifted = x;
+            double h = 1e-6 * std::max(std::abs(x[j]), 1e-2);
+            if (shifted[j] + h > UPPER_BOUNDS[j]) {
+                h = -h;
+            }
+            shifted[j] += h;
+            residuals(strips, quotes, shifted.data(), jacobian[j]);
+            for (size_t i = 0; i < m; ++i) {
+                jacobian[j][i] = (jacobian[j][i] - r[i]) / h;
+            }
+        }
+    };
+    
+    double lambda = 1e-3;
+    int iteration = 0;
+    bool converged = false;
+    
+    std::vector<double> trial_r(m);
+    while (iteration < MAX_ITERATIONS && !converged) {
+        ++iteration;
+        
+        detail::parallel_for(NUM_PARAMS, num_threads, compute_columns);
+        
+        std::array<std::array<double, NUM_PARAMS>, NUM_PARAMS> jtj{};
+        std::array<double, NUM_PARAMS> jtr{};
+        for (size_t a = 0; a < NUM_PARAMS; ++a) {
+            for (size_t b = a; b < NUM_PARAMS; ++b) {
+                double sum = 0.0;
+                for (size_t i = 0; i < m; ++i) {
+                    sum += jacobian[a][i] * jacobian[b][i];
+                }
+                jtj[a][b] = sum;
+                jtj[b][a] = sum;
+            }
+            double sum = 0.0;
+            for (size_t i = 0; i < m; ++i) {
+                sum += jacobian[a][i] * r[i];
+            }
+            jtr[a] = sum;
+        }
+        
+        bool improved = false;
+        while (!improved && lambda < 1e12) {
+            auto damped = jtj;
+            std::array<double, NUM_PARAMS> step;
+            for (size_t a = 0; a < NUM_PARAMS; ++a) {
+                damped[a][a] += lambda * std::max(jtj[a][a], 1e-12);
+                step[a] = -jtr[a];
+            }
+            
+            if (!solve_linear_system(damped, step)) {
+                lambda *= 10.0;
+                continue;
+            }
+            
+            std::array<double, NUM_PARAMS> trial = x;
+            for (size_t a = 0; a < NUM_PARAMS; ++a) {
+                trial[a] += step[a];
+            }
+            project(trial.data());
+            
+            residuals(strips, quotes, trial.data(), trial_r);
+            double trial_cost = 0.0;
+            for (double v : trial_r) {
+                trial_cost += v * v;
+            }
+            
+            if (trial_cost < cost) {
+                double reduction = cost - trial_cost;
+                x = trial;
+                r.swap(trial_r);
+                cost = trial_cost;
+                lambda = std::max(lambda / 3.0, 1e-12);
+                improved = true;
+                if (reduction <= TOLERANCE * (1.0 + cost) || cost < TOLERANCE) {
+                    converged = true;
+                }
+            } else {
+                lambda *= 4.0;
+            }
+        }
+        
+        if (!improved) {
+            converged = true;
+        }
+    }
+    
+    return {to_parameters(x.data()), std::sqrt(cost / m), iteration, converged};
+}
+
+}
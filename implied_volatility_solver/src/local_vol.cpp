@@ -0,0 +1,240 @@
+#include "local_vol.hpp"
+#include "parallel.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace implied_vol {
+
+LocalVolSurface::LocalVolSurface(
+    double min_strike,
+    double max_strike,
+    size_t num_strikes,
+    const std::vector<double>& expiries,
+    std::vector<double> local_vols,
+    size_t clamped_nodes
+) : min_strike_(min_strike), dk_(0.0), num_strikes_(num_strikes), expiries_(expiries),
+    values_(std::move(local_vols)), clamped_nodes_(clamped_nodes) {
+    if (num_strikes < 2 || min_strike <= 0 || max_strike <= min_strike) {
+        throw std::invalid_argument("Strike grid needs at least two increasing positive points");
+    }
+    
+    if (expiries_.empty()) {
+        throw std::invalid_argument("Local vol grid needs at least one expiry");
+    }
+    
+    for (size_t i = 0; i < expiries_.size(); ++i) {
+        if (expiries_[i] <= 0 || (i > 0 && expiries_[i] <= expiries_[i - 1])) {
+            throw std::invalid_argument("Expiries must be positive and strictly increasing");
+        }
+    }
+    
+    if (values_.size() != num_strikes * expiries_.size()) {
+        throw std::invalid_argument("Local vol grid size does not match axes");
+    }
+    
+    dk_ = (max_strike - min_strike) / (num_strikes - 1);
+}
+
+double LocalVolSurface::local_vol(double strike, double time_to_expiry) const {
+    double x = std::clamp((strike - min_strike_) / dk_, 0.0, static_cast<double>(num_strikes_ - 1));
+    size_t j = std::min(static_cast<size_t>(x), num_strikes_ - 2);
+    double f = x - j;
+    
+    auto row_value = [&](size_t t) {
+        const double* r = row(t) + j;
+        return r[0] + f * (r[1] - r[0]);
+    };
+    
+    if (time_to_expiry <= expiries_.front()) {
+        return row_value(0);
+    }
+    if (time_to_expiry >= expiries_.back()) {
+        return row_value(expiries_.size() - 1);
+    }
+    
+    auto it = std::upper_bound(expiries_.begin(), expiries_.end(), time_to_expiry);
+    size_t i = static_cast<size_t>(it - expiries_.begin()) - 1;
+    double weight = (time_to_expiry - expiries_[i]) / (expiries_[i + 1] - expiries_[i]);
+    return row_value(i) + weight * (row_value(i + 1) - row_value(i));
+}
+
+LocalVolBuilder::LocalVolBuilder(double spot, double risk_free_rate, unsigned num_threads)
+    : spot_(spot), rate_(risk_free_rate), num_threads_(num_threads) {
+    if (spot <= 0) {
+        throw std::invalid_argument("Spot must be positive");
+    }
+}
+
+double LocalVolBuilder::dupire_variance(
+    double log_moneyness,
+    double total_variance,
+    double dw_dk,
+    double d2w_dk2,
+    double dw_dt
+) {
+    double y = log_moneyness;
+    double w = total_variance;
+    double denominator = 1.0 - y / w * dw_dk +
+                         0.25 * (-0.25 - 1.0 / w + y * y / (w * w)) * dw_dk * dw_dk +
+                         0.5 * d2w_dk2;
+    return dw_dt / denominator;
+}
+
+template <typename Derivatives>
+LocalVolSurface LocalVolBuilder::evaluate_grid(
+    Derivatives&& derivatives,
+    double min_strike,
+    double max_strike,
+    size_t num_strikes,
+    const std::vector<double>& expiries
+) const {
+    if (num_strikes < 2 || min_strike <= 0 || max_strike <= min_strike) {
+        throw std::invalid_argument("Strike grid needs at least two increasing positive points");
+    }
+    
+    for (size_t i = 0; i < expiries.size(); ++i) {
+        if (expiries[i] <= 0 || (i > 0 && expiries[i] <= expiries[i - 1])) {
+            throw std::invalid_argument("Expiries must be positive and strictly increasing");
+        }
+    }
+    
+    std::vector<double> values(num_strikes * expiries.size());
+    std::vector<size_t> clamped(expiries.size(), 0);
+    double dk = (max_strike - min_strike) / (num_strikes - 1);
+    
+    auto worker = [&](size_t begin, size_t end) {
+        for (size_t t = begin; t < end; ++t) {
+            double T = expiries[t];
+            double log_forward = std::log(spot_) + rate_ * T;
+            double* out = values.data() + t * num_strikes;
+            
+            for (size_t j = 0; j < num_strikes; ++j) {
+                double y = std::log(min_strike + j * dk) - log_forward;
+                VarianceDerivatives d = derivatives(y, T);
+                
+                double variance = (d.w > 0)
+                    ? dupire_variance(y, d.w, d.dw_dk, d.d2w_dk2, d.dw_dt)
+                    : -1.0;
+                if (!(variance >= MIN_LOCAL_VARIANCE) || !std::isfinite(variance)) {
+                    variance = MIN_LOCAL_VARIANCE;
+                    ++clamped[t];
+                }
+                out[j] = std::sqrt(variance);
+            }
+        }
+    };
+    
+    detail::parallel_for(expiries.size(), num_threads_, worker);
+    
+    size_t total_clamped = 0;
+    for (size_t c : clamped) {
+        total_clamped += c;
+    }
+    
+    return LocalVolSurface(min_strike, max_strike, num_strikes, expiries, std::move(values), total_clamped);
+}
+
+LocalVolSurface LocalVolBuilder::build(
+    const SSVIParameters& params,
+    double min_strike,
+    double max_strike,
+    size_t num_strikes,
+    const std::vector<double>& expiries
+) const {
+    const std::vector<double>& knots = params.expiries;
+    const std::vector<double>& thetas = params.atm_variances;
+    if (knots.empty() || knots.size() != thetas.size()) {
+        throw std::invalid_argument("SSVI surface has no ATM term structure");
+    }
+    
+    auto theta_slope = [&](double T) {
+        if (T < knots.front()) {
+            return thetas.front() / knots.front();
+        }
+        if (T >= knots.back()) {
+            return thetas.back() / knots.back();
+        }
+        size_t i = static_cast<size_t>(std::upper_bound(knots.begin(), knots.end(), T) - knots.begin());
+        return (thetas[i] - thetas[i - 1]) / (knots[i] - knots[i - 1]);
+    };
+    
+    double rho = params.rho;
+    auto derivatives = [&](double y, double T) {
+        double theta = params.atm_variance(T);
+        double phi = params.eta * std::pow(theta, -params.gamma);
+        double p = phi * y;
+        double root = std::sqrt((p + rho) * (p + rho) + 1.0 - rho * rho);
+        double skew = rho + (p + rho) / root;
+        
+        double w = 0.5 * theta * (1.0 + rho * p + root);
+        double dw_dk = 0.5 * theta * phi * skew;
+        double d2w_dk2 = 0.5 * theta * phi * phi * (1.0 - rho * rho) / (root * root * root);
+        double dp_dtheta = -params.gamma * p / theta;
+        double dw_dtheta = 0.5 * (1.0 + rho * p + root) + 0.5 * theta * skew * dp_dtheta;
+        
+        return VarianceDerivatives{w, dw_dk, d2w_dk2, dw_dtheta * theta_slope(T)};
+    };
+    
+    return evaluate_grid(derivatives, min_strike, max_strike, num_strikes, expiries);
+}
+
+LocalVolSurface LocalVolBuilder::build(
+    const std::vector<double>& slice_expiries,
+    const std::vector<SVIParameters>& slices,
+    double min_strike,
+    double max_strike,
+    size_t num_strikes,
+    const std::vector<double>& expiries
+) const {
+    if (slice_expiries.empty() || slice_expiries.size() != slices.size()) {
+        throw std::invalid_argument("Expiries and SVI slices must have the same non-zero size");
+    }
+    
+    for (size_t i = 0; i < slice_expiries.size(); ++i) {
+        if (slice_expiries[i] <= 0 || (i > 0 && slice_expiries[i] <= slice_expiries[i - 1])) {
+            throw std::invalid_argument("Expiries must be positive and strictly increasing");
+        }
+    }
+    
+    auto slice_derivatives = [&](size_t i, double y) {
+        const SVIParameters& s = slices[i];
+        double x = y - s.m;
+        double root = std::sqrt(x * x + s.sigma * s.sigma);
+        return VarianceDerivatives{
+            s.total_variance(y),
+            s.b * (s.rho + x / root),
+            s.b * s.sigma * s.sigma / (root * root * root),
+            0.0
+        };
+    };
+    
+    auto derivatives = [&](double y, double T) {
+        const size_t n = slice_expiries.size();
+        if (n == 1 || T < slice_expiries.front() || T >= slice_expiries.back()) {
+            size_t i = (T < slice_expiries.front()) ? 0 : n - 1;
+            double scale = T / slice_expiries[i];
+            VarianceDerivatives d = slice_derivatives(i, y);
+            return VarianceDerivatives{d.w * scale, d.dw_dk * scale, d.d2w_dk2 * scale,
+                                       d.w / slice_expiries[i]};
+        }
+        
+        size_t i = static_cast<size_t>(
+            std::upper_bound(slice_expiries.begin(), slice_expiries.end(), T) - slice_expiries.begin()) - 1;
+        double span = slice_expiries[i + 1] - slice_expiries[i];
+        double weight = (T - slice_expiries[i]) / span;
+        VarianceDerivatives lo = slice_derivatives(i, y);
+        VarianceDerivatives hi = slice_derivatives(i + 1, y);
+        
+        return VarianceDerivatives{
+            lo.w + weight * (hi.w - lo.w),
+            lo.dw_dk + weight * (hi.dw_dk - lo.dw_dk),
+            lo.d2w_dk2 + weight * (hi.d2w_dk2 - lo.d2w_dk2),
+            (hi.w - lo.w) / span
+        };
+    };
+    
+    return evaluate_grid(derivatives, min_strike, max_strike, num_strikes, expiries);
+}
+
+}
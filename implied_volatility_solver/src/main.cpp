@@ -3,6 +3,7 @@
 #include <iomanip>
 #include <vector>
 #include <chrono>
+#include <cmath>
 
 using namespace implied_vol;
 
@@ -0,0 +1,283 @@
+#include "monte_carlo.hpp"
+#include "parallel.hpp"
+#include "philox.hpp"
+#include "sobol.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace implied_vol {
+
+namespace {
+
+constexpr double MIN_EXPONENT = -708.0;
+constexpr double MAX_EXPONENT = 709.0;
+
+double exp_branch_free(double x) {
+    constexpr double LOG2E = 1.4426950408889634;
+    constexpr double LN2_HI = 6.93147180369123816490e-01;
+    constexpr double LN2_LO = 1.90821492927058770002e-10;
+    constexpr double ROUND = 6755399441055744.0;
+    
+    double shifted = x * LOG2E + ROUND;
+    double n = shifted - ROUND;
+    double r = (x - n * LN2_HI) - n * LN2_LO;
+    
+    double p = 1.0 / 479001600.0;
+    p = p * r + 1.0 / 39916800.0;
+    p = p * r + 1.0 / 3628800.0;
+    p = p * r + 1.0 / 362880.0;
+    p = p * r + 1.0 / 40320.0;
+    p = p * r + 1.0 / 5040.0;
+    p = p * r + 1.0 / 720.0;
+    p = p * r + 1.0 / 120.0;
+    p = p * r + 1.0 / 24.0;
+    p = p * r + 1.0 / 6.0;
+    p = p * r + 0.5;
+    p = p * r + 1.0;
+    p = p * r + 1.0;
+    
+    int64_t bits;
+    std::memcpy(&bits, &shifted, sizeof(bits));
+    int64_t scale_bits = (bits - 0x4338000000000000LL + 1023) << 52;
+    double scale;
+    std::memcpy(&scale, &scale_bits, sizeof(scale));
+    return p * scale;
+}
+
+}
+
+bool PathPayoff::is_barrier() const {
+    return kind == PathPayoffType::UP_AND_OUT || kind == PathPayoffType::DOWN_AND_OUT ||
+           kind == PathPayoffType::UP_AND_IN || kind == PathPayoffType::DOWN_AND_IN;
+}
+
+MonteCarloEngine::MonteCarloEngine(const MonteCarloSettings& settings) : settings_(settings) {
+    if (settings.num_paths == 0 || settings.num_steps == 0) {
+        throw std::invalid_argument("Path and step counts must be positive");
+    }
+    
+    if (settings.sampling != SamplingMethod::PSEUDO_RANDOM && settings.num_steps > SobolSequence::MAX_DIMENSION) {
+        throw std::invalid_argument("Too many steps for Sobol sampling");
+    }
+}
+
+void MonteCarloEngine::simulate_block(
+    const OptionSpec& spec,
+    double volatility,
+    const PathPayoff& payoff,
+    size_t first_sample,
+    size_t num_samples,
+    Moments& moments
+) const {
+    const size_t steps = settings_.num_steps;
+    const size_t width = settings_.antithetic ? 2 * LANES : LANES;
+    const double dt = spec.time_to_expiry / steps;
+    const double drift = (spec.risk_free_rate - 0.5 * volatility * volatility) * dt;
+    const double diffusion = volatility * std::sqrt(dt);
+    const double discount = std::exp(-spec.risk_free_rate * spec.time_to_expiry);
+    const double strike = spec.strike;
+    const bool is_call = spec.type == OptionType::CALL;
+    const bool up = payoff.kind == PathPayoffType::UP_AND_OUT || payoff.kind == PathPayoffType::UP_AND_IN;
+    const bool down = payoff.kind == PathPayoffType::DOWN_AND_OUT || payoff.kind == PathPayoffType::DOWN_AND_IN;
+    const double barrier = payoff.barrier;
+    
+    Philox4x32 rng(settings_.seed);
+    std::vector<double> normals(steps * LANES);
+    std::vector<double> growth(steps * LANES);
+    std::vector<double> mirrored(settings_.antithetic ? steps * LANES : 0);
+    std::vector<double> lane_normals(steps);
+    std::vector<double> bridge_normals;
+    
+    std::unique_ptr<SobolSequence> sobol;
+    std::unique_ptr<BrownianBridge> bridge;
+    if (settings_.sampling != SamplingMethod::PSEUDO_RANDOM) {
+        sobol = std::make_unique<SobolSequence>(steps, first_sample);
+    }
+    if (settings_.sampling == SamplingMethod::SOBOL_BRIDGE) {
+        bridge = std::make_unique<BrownianBridge>(steps);
+        bridge_normals.resize(steps);
+    }
+    
+    double spot[2 * LANES];
+    double running_sum[2 * LANES];
+    double running_max[2 * LANES];
+    double running_min[2 * LANES];
+    
+    auto vanilla = [&](double s) {
+        return is_call ? std::max(s - strike, 0.0) : std::max(strike - s, 0.0);
+    };
+    
+    const double upper = up ? barrier : HUGE_VAL;
+    const double lower = down ? barrier : -HUGE_VAL;
+    const double mirror = std::exp(2.0 * drift);
+    
+    auto advance = [&](size_t offset, const double* factors, size_t lanes) {
+        for (size_t l = 0; l < lanes; ++l) {
+            double s = spot[offset + l] * factors[l];
+            spot[offset + l] = s;
+            running_sum[offset + l] += s;
+            running_max[offset + l] = std::max(running_max[offset + l], s);
+            running_min[offset + l] = std::min(running_min[offset + l], s);
+        }
+    };
+    
+    for (size_t base = 0; base < num_samples; base += LANES) {
+        size_t lanes = std::min(LANES, num_samples - base);
+        
+        if (sobol) {
+            for (size_t l = 0; l < LANES; ++l) {
+                if (l < lanes && bridge) {
+                    sobol->next_normals(bridge_normals.data());
+                    bridge->build_increments(bridge_normals.data(), lane_normals.data());
+                } else if (l < lanes) {
+                    sobol->next_normals(lane_normals.data());
+                } else {
+                    std::fill(lane_normals.begin(), lane_normals.end(), 0.0);
+                }
+                for (size_t step = 0; step < steps; ++step) {
+                    normals[step * LANES + l] = lane_normals[step];
+                }
+            }
+        } else {
+            rng.normals_interleaved(first_sample + base, LANES, normals.data(), steps);
+        }
+        
+        for (size_t i = 0; i < normals.size(); ++i) {
+            growth[i] = std::min(std::max(drift + diffusion * normals[i], MIN_EXPONENT), MAX_EXPONENT);
+        }
+        for (size_t i = 0; i < growth.size(); ++i) {
+            growth[i] = exp_branch_free(growth[i]);
+        }
+        for (size_t i = 0; i < mirrored.size(); ++i) {
+            mirrored[i] = mirror / growth[i];
+        }
+        
+        for (size_t l = 0; l < width; ++l) {
+            spot[l] = spec.spot;
+            running_sum[l] = 0.0;
+            running_max[l] = spec.spot;
+            running_min[l] = spec.spot;
+        }
+        
+        for (size_t step = 0; step < steps; ++step) {
+            advance(0, growth.data() + step * LANES, lanes);
+            if (settings_.antithetic) {
+                advance(LANES, mirrored.data() + step * LANES, lanes);
+            }
+        }
+        
+        double values[2 * LANES];
+        double controls[2 * LANES];
+        for (size_t l = 0; l < width; ++l) {
+            double terminal = vanilla(spot[l]);
+            double value = terminal;
+            bool crossed = running_max[l] >= upper || running_min[l] <= lower;
+            switch (payoff.kind) {
+                case PathPayoffType::ASIAN:
+                    value = vanilla(running_sum[l] / steps);
+                    break;
+                case PathPayoffType::UP_AND_OUT:
+                case PathPayoffType::DOWN_AND_OUT:
+                    value = crossed ? 0.0 : terminal;
+                    break;
+                case PathPayoffType::UP_AND_IN:
+                case PathPayoffType::DOWN_AND_IN:
+                    value = crossed ? terminal : 0.0;
+                    break;
+                case PathPayoffType::LOOKBACK:
+                    value = is_call ? std::max(running_max[l] - strike, 0.0)
+                                    : std::max(strike - running_min[l], 0.0);
+                    break;
+                default:
+                    break;
+            }
+            values[l] = discount * value;
+            controls[l] = discount * terminal;
+        }
+        
+        for (size_t l = 0; l < lanes; ++l) {
+            double x = values[l];
+            double y = controls[l];
+            if (settings_.antithetic) {
+                x = 0.5 * (x + values[l + LANES]);
+                y = 0.5 * (y + controls[l + LANES]);
+            }
+            moments.count += 1.0;
+            moments.sum_x += x;
+            moments.sum_y += y;
+            moments.sum_xx += x * x;
+            moments.sum_yy += y * y;
+            moments.sum_xy += x * y;
+        }
+    }
+}
+
+MonteCarloResult MonteCarloEngine::price(
+    const OptionSpec& spec,
+    double volatility,
+    const PathPayoff& payoff
+) const {
+    if (spec.spot <= 0 || spec.strike <= 0 || spec.time_to_expiry <= 0) {
+        throw std::invalid_argument("Spot, strike and time to expiry must be positive");
+    }
+    
+    if (volatility <= 0) {
+        throw std::invalid_argument("Volatility must be positive");
+    }
+    
+    if (payoff.is_barrier() && payoff.barrier <= 0) {
+        throw std::invalid_argument("Barrier level must be positive");
+    }
+    
+    size_t samples = settings_.antithetic ? (settings_.num_paths + 1) / 2 : settings_.num_paths;
+    size_t num_blocks = (samples + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    std::vector<Moments> block_moments(num_blocks);
+    
+    auto worker = [&](size_t begin, size_t end) {
+        for (size_t b = begin; b < end; ++b) {
+            size_t first = b * BLOCK_SIZE;
+            simulate_block(spec, volatility, payoff, first, std::min(BLOCK_SIZE, samples - first),
+                           block_moments[b]);
+        }
+    };
+    
+    detail::parallel_for(num_blocks, settings_.num_threads, worker);
+    
+    Moments total;
+    for (const auto& m : block_moments) {
+        total.count += m.count;
+        total.sum_x += m.sum_x;
+        total.sum_y += m.sum_y;
+        total.sum_xx += m.sum_xx;
+        total.sum_yy += m.sum_yy;
+        total.sum_xy += m.sum_xy;
+    }
+    
+    double n = total.count;
+    double mean_x = total.sum_x / n;
+    double mean_y = total.sum_y / n;
+    double denom = std::max(n - 1.0, 1.0);
+    double var_x = std::max(0.0, (total.sum_xx - n * mean_x * mean_x) / denom);
+    double var_y = std::max(0.0, (total.sum_yy - n * mean_y * mean_y) / denom);
+    double cov = (total.sum_xy - n * mean_x * mean_y) / denom;
+    
+    double estimate = mean_x;
+    double variance = var_x;
+    double beta = 0.0;
+    
+    if (settings_.control_variate && var_y > 1e-300) {
+        beta = cov / var_y;
+        estimate = mean_x - beta * (mean_y - bs_engine_.price(spec, volatility));
+        variance = std::max(0.0, var_x - cov * cov / var_y);
+    }
+    
+    size_t paths = settings_.antithetic ? 2 * samples : samples;
+    return {estimate, std::sqrt(variance / n), paths, beta};
+}
+
+}
@@ -3,29 +3,84 @@
 
 namespace implied_vol {
 
-double NormalDistribution::erf_approx(double x) {
-    constexpr double a1 =  0.254829592;
-    constexpr double a2 = -0.284496736;
-    constexpr double a3 =  1.421413741;
-    constexpr double a4 = -1.453152027;
-    constexpr double a5 =  1.061405429;
-    constexpr double p  =  0.3275911;
+namespace {
+
+constexpr double a1 = -3.969683028665376e+01;
+constexpr double a2 =  2.209460984245205e+02;
+constexpr double a3 = -2.759285104469687e+02;
+constexpr double a4 =  1.383577518672690e+02;
+constexpr double a5 = -3.066479806614716e+01;
+constexpr double a6 =  2.506628277459239e+00;
+
+constexpr double b1 = -5.447609879822406e+01;
+constexpr double b2 =  1.615858368580409e+02;
+constexpr double b3 = -1.556989798598866e+02;
+constexpr double b4 =  6.680131188771972e+01;
+constexpr double b5 = -1.328068155288572e+01;
+
+constexpr double c1 = -7.784894002430293e-03;
+constexpr double c2 = -3.223964580411365e-01;
+constexpr double c3 = -2.400758277161838e+00;
+constexpr double c4 = -2.549732539343734e+00;
+constexpr double c5 =  4.374664141464968e+00;
+constexpr double c6 =  2.938163982698783e+00;
+
+constexpr double d1 =  7.784695709041462e-03;
+constexpr double d2 =  3.224671290700398e-01;
+constexpr double d3 =  2.445134137142996e+00;
+constexpr double d4 =  3.754408661907416e+00;
+
+constexpr double P_LOW = 0.02425;
+
+inline double central_inverse(double p) {
+    double q = p - 0.5;
+    double r = q * q;
+    return (((((a1 * r + a2) * r + a3) * r + a4) * r + a5) * r + a6) * q /
+           (((((b1 * r + b2) * r + b3) * r + b4) * r + b5) * r + 1.0);
+}
+
+inline double tail_inverse(double p) {
+    double q = std::sqrt(-2.0 * std::log(p));
+    return (((((c1 * q + c2) * q + c3) * q + c4) * q + c5) * q + c6) /
+           ((((d1 * q + d2) * q + d3) * q + d4) * q + 1.0);
+}
+
+}
+
+template <typename Scalar>
+double BasicNormalDistribution<Scalar>::inverse_cdf(double p) {
+    if (p <= 0.0) {
+        return -HUGE_VAL;
+    }
+    if (p >= 1.0) {
+        return HUGE_VAL;
+    }
     
-    int sign = (x >= 0) ? 1 : -1;
-    x = std::abs(x);
+    if (p < P_LOW) {
+        return tail_inverse(p);
+    }
     
-    double t = 1.0 / (1.0 + p * x);
-    double y = 1.0 - (((((a5 * t + a4) * t) + a3) * t + a2) * t + a1) * t * std::exp(-x * x);
+    if (p > 1.0 - P_LOW) {
+        return -tail_inverse(1.0 - p);
+    }
     
-    return sign * y;
+    return central_inverse(p);
 }
 
-double NormalDistribution::cdf(double x) {
-    return 0.5 * (1.0 + erf_approx(x / SQRT_2));
+template <typename Scalar>
+void BasicNormalDistribution<Scalar>::inverse_cdf(const double* p, double* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = central_inverse(p[i]);
+    }
+    
+    for (size_t i = 0; i < count; ++i) {
+        double u = p[i];
+        if (u < P_LOW || u > 1.0 - P_LOW) {
+            out[i] = inverse_cdf(u);
+        }
+    }
 }
 
-double NormalDistribution::pdf(double x) {
-    return INV_SQRT_2PI * std::exp(-0.5 * x * x);
-}
+template class BasicNormalDistribution<double>;
 
 }
@@ -0,0 +1,118 @@
+#include "philox.hpp"
+#include "normal_distribution.hpp"
+#include <algorithm>
+
+namespace implied_vol {
+
+namespace {
+
+constexpr uint32_t MULTIPLIER_0 = 0xD2511F53u;
+constexpr uint32_t MULTIPLIER_1 = 0xCD9E8D57u;
+constexpr uint32_t WEYL_0 = 0x9E3779B9u;
+constexpr uint32_t WEYL_1 = 0xBB67AE85u;
+
+}
+
+Philox4x32::Counter Philox4x32::operator()(Counter c) const {
+    uint32_t k0 = key_[0];
+    uint32_t k1 = key_[1];
+    
+    for (int round = 0; round < ROUNDS; ++round) {
+        uint64_t p0 = static_cast<uint64_t>(MULTIPLIER_0) * c[0];
+        uint64_t p1 = static_cast<uint64_t>(MULTIPLIER_1) * c[2];
+        c = {static_cast<uint32_t>(p1 >> 32) ^ c[1] ^ k0, static_cast<uint32_t>(p1),
+             static_cast<uint32_t>(p0 >> 32) ^ c[3] ^ k1, static_cast<uint32_t>(p0)};
+        k0 += WEYL_0;
+        k1 += WEYL_1;
+    }
+    
+    return c;
+}
+
+void Philox4x32::uniforms(uint64_t stream, uint64_t offset, double* out, size_t count) const {
+    size_t i = 0;
+    uint64_t block = offset / 4;
+    size_t skip = static_cast<size_t>(offset % 4);
+    
+    while (i < count) {
+        Counter r = (*this)({static_cast<uint32_t>(block), static_cast<uint32_t>(block >> 32),
+                             static_cast<uint32_t>(stream), static_cast<uint32_t>(stream >> 32)});
+        for (size_t j = skip; j < 4 && i < count; ++j) {
+            out[i++] = to_uniform(r[j]);
+        }
+        skip = 0;
+        ++block;
+    }
+}
+
+void Philox4x32::normals(uint64_t stream, uint64_t offset, double* out, size_t count) const {
+    uniforms(stream, offset, out, count);
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = NormalDistribution::inverse_cdf(out[i]);
+    }
+}
+
+void Philox4x32::uniforms_interleaved(uint64_t first_stream, size_t num_streams, double* out, size_t count) const {
+    interleaved(first_stream, num_streams, out, count, false);
+}
+
+void Philox4x32::normals_interleaved(uint64_t first_stream, size_t num_streams, double* out, size_t count) const {
+    interleaved(first_stream, num_streams, out, count, true);
+}
+
+void Philox4x32::interleaved(
+    uint64_t first_stream,
+    size_t num_streams,
+    double* out,
+    size_t count,
+    bool normal
+) const {
+    for (size_t s0 = 0; s0 < num_streams; s0 += BATCH) {
+        size_t width = std::min(BATCH, num_streams - s0);
+        
+        for (uint64_t block = 0; 4 * block < count; ++block) {
+            uint32_t c0[BATCH];
+            uint32_t c1[BATCH];
+            uint32_t c2[BATCH];
+            uint32_t c3[BATCH];
+            for (size_t l = 0; l < width; ++l) {
+                uint64_t stream = first_stream + s0 + l;
+                c0[l] = static_cast<uint32_t>(block);
+                c1[l] = static_cast<uint32_t>(block >> 32);
+                c2[l] = static_cast<uint32_t>(stream);
+                c3[l] = static_cast<uint32_t>(stream >> 32);
+            }
+            
+            uint32_t k0 = key_[0];
+            uint32_t k1 = key_[1];
+            for (int round = 0; round < ROUNDS; ++round) {
+                for (size_t l = 0; l < width; ++l) {
+                    uint64_t p0 = static_cast<uint64_t>(MULTIPLIER_0) * c0[l];
+                    uint64_t p1 = static_cast<uint64_t>(MULTIPLIER_1) * c2[l];
+                    c0[l] = static_cast<uint32_t>(p1 >> 32) ^ c1[l] ^ k0;
+                    c1[l] = static_cast<uint32_t>(p1);
+                    c2[l] = static_cast<uint32_t>(p0 >> 32) ^ c3[l] ^ k1;
+                    c3[l] = static_cast<uint32_t>(p0);
+                }
+                k0 += WEYL_0;
+                k1 += WEYL_1;
+            }
+            
+            const uint32_t* words[4] = {c0, c1, c2, c3};
+            for (size_t j = 0; j < 4 && 4 * block + j < count; ++j) {
+                double uniforms[BATCH];
+                for (size_t l = 0; l < width; ++l) {
+                    uniforms[l] = to_uniform(words[j][l]);
+                }
+                double* row = out + (4 * block + j) * num_streams + s0;
+                if (normal) {
+                    NormalDistribution::inverse_cdf(uniforms, row, width);
+                } else {
+                    std::copy(uniforms, uniforms + width, row);
+                }
+            }
+        }
+    }
+}
+
+}
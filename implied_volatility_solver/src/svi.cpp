@@ -0,0 +1,539 @@
+#include "svi.hpp"
+#include "parallel.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+namespace implied_vol {
+
+namespace {
+
+constexpr double MIN_SIGMA = 1e-4;
+constexpr double MAX_SIGMA = 5.0;
+constexpr double MAX_RHO = 0.999;
+constexpr double FEASIBILITY_EPS = 1e-12;
+
+struct SliceData {
+    double time_to_expiry;
+    std::vector<double> log_moneyness;
+    std::vector<double> total_variance;
+    std::vector<double> vols;
+};
+
+SliceData extract(const SmileSlice& slice, size_t min_points) {
+    if (slice.time_to_expiry <= 0 || slice.forward <= 0) {
+        throw std::invalid_argument("Slice expiry and forward must be positive");
+    }
+    
+    const VolSmile& smile = slice.smile;
+    if (smile.strikes.size() != smile.implied_vols.size()) {
+        throw std::invalid_argument("Smile strikes and vols must have the same size");
+    }
+    
+    SliceData data{slice.time_to_expiry, {}, {}, {}};
+    for (size_t i = 0; i < smile.strikes.size(); ++i) {
+        bool ok = i >= smile.statuses.size() || smile.statuses[i] == ConvergenceStatus::SUCCESS;
+        double vol = smile.implied_vols[i];
+        if (!ok || vol <= 0 || smile.strikes[i] <= 0) {
+            continue;
+        }
+        data.log_moneyness.push_back(std::log(smile.strikes[i] / slice.forward));
+        data.total_variance.push_back(vol * vol * slice.time_to_expiry);
+        data.vols.push_back(vol);
+    }
+    
+    if (data.log_moneyness.size() < min_points) {
+        throw std::invalid_argument("Not enough converged smile points to fit");
+    }
+    return data;
+}
+
+std::vector<SliceData> extract_surface(const std::vector<SmileSlice>& slices) {
+    if (slices.empty()) {
+        throw std::invalid_argument("No smile slices to fit");
+    }
+    
+    std::vector<SliceData> data;
+    data.reserve(slices.size());
+    for (const auto& slice : slices) {
+        data.push_back(extract(slice, 1));
+    }
+    std::sort(data.begin(), data.end(), [](const SliceData& lhs, const SliceData& rhs) {
+        return lhs.time_to_expiry < rhs.time_to_expiry;
+    });
+    
+    for (size_t i = 1; i < data.size(); ++i) {
+        if (data[i].time_to_expiry <= data[i - 1].time_to_expiry) {
+            throw std::invalid_argument("Slice expiries must be distinct");
+        }
+    }
+    return data;
+}
+
+template <size_t N, typename F>
+int nelder_mead(F&& f, std::array<double, N>& x, double step, int max_iterations, double tolerance) {
+    using Point = std::array<double, N>;
+    std::array<Point, N + 1> simplex;
+    std::array<double, N + 1> values;
+    
+    for (size_t i = 0; i <= N; ++i) {
+        simplex[i] = x;
+        if (i > 0) {
+            simplex[i][i - 1] += step;
+        }
+        values[i] = f(simplex[i]);
+    }
+    
+    auto blend = [](const Point& from, const Point& to, double t) {
+        Point p;
+        for (size_t j = 0; j < N; ++j) {
+            p[j] = from[j] + t * (to[j] - from[j]);
+        }
+        return p;
+    };
+    
+    int iteration = 0;
+    for (; iteration < max_iterations; ++iteration) {
+        for (size_t i = 1; i <= N; ++i) {
+            for (size_t j = i; j > 0 && values[j] < values[j - 1]; --j) {
+                std::swap(values[j], values[j - 1]);
+                std::swap(simplex[j], simplex[j - 1]);
+            }
+        }
+        
+        double diameter = 0.0;
+        for (size_t i = 1; i <= N; ++i) {
+            for (size_t j = 0; j < N; ++j) {
+                diameter = std::max(diameter, std::abs(simplex[i][j] - simplex[0][j]));
+            }
+        }
+        if (values[N] - values[0] <= tolerance || diameter < 1e-10) {
+            break;
+        }
+        
+        Point centroid{};
+        for (size_t i = 0; i < N; ++i) {
+            for (size_t j = 0; j < N; ++j) {
+                centroid[j] += simplex[i][j] / N;
+            }
+        }
+        
+        Point reflected = blend(centroid, simplex[N], -1.0);
+        double f_reflected = f(reflected);
+        
+        if (f_reflected < values[0]) {
+            Point expanded = blend(centroid, simplex[N], -2.0);
+            double f_expanded = f(expanded);
+            if (f_expanded < f_reflected) {
+                simplex[N] = expanded;
+                values[N] = f_expanded;
+            } else {
+                simplex[N] = reflected;
+                values[N] = f_reflected;
+            }
+        } else if (f_reflected < values[N - 1]) {
+            simplex[N] = reflected;
+            values[N] = f_reflected;
+        } else {
+            bool outside = f_reflected < values[N];
+            Point contracted = outside ? blend(centroid, reflected, 0.5)
+                                       : blend(centroid, simplex[N], 0.5);
+            double f_contracted = f(contracted);
+            
+            if (f_contracted < std::min(f_reflected, values[N])) {
+                simplex[N] = contracted;
+                values[N] = f_contracted;
+            } else {
+                for (size_t i = 1; i <= N; ++i) {
+                    simplex[i] = blend(simplex[0], simplex[i], 0.5);
+                    values[i] = f(simplex[i]);
+                }
+            }
+        }
+    }
+    
+    size_t best = static_cast<size_t>(std::min_element(values.begin(), values.end()) - values.begin());
+    x = simplex[best];
+    return iteration;
+}
+
+struct LinearFit {
+    double a;
+    double d;
+    double c;
+    double sse;
+};
+
+class QuasiExplicitFit {
+public:
+    QuasiExplicitFit(const SliceData& data, double m, double sigma)
+        : w_(data.total_variance), sigma_(sigma) {
+        y_.reserve(w_.size());
+        z_.reserve(w_.size());
+        for (double k : data.log_moneyness) {
+            double y = (k - m) / sigma;
+            y_.push_back(y);
+            z_.push_back(std::sqrt(y * y + 1.0));
+        }
+    }
+    
+    LinearFit solve() const {
+        LinearFit best{0.0, 0.0, 0.0, std::numeric_limits<double>::infinity()};
+        double limit = 4.0 * sigma_;
+        
+        consider(unconstrained(), best);
+        for (double s : {1.0, -1.0}) {
+            auto [a, c] = fit_affine([&](size_t i) { return z_[i] + s * y_[i]; },
+                                     [&](size_t i) { return w_[i]; });
+            consider({a, s * c, c, 0.0}, best);
+            
+            auto [a2, c2] = fit_affine([&](size_t i) { return z_[i] - s * y_[i]; },
+                                       [&](size_t i) { return w_[i] - s * limit * y_[i]; });
+            consider({a2, s * (limit - c2), c2, 0.0}, best);
+            
+            consider(fit_level(s * 0.5 * limit, 0.5 * limit), best);
+        }
+        consider(fit_level(0.0, 0.0), best);
+        consider(fit_level(0.0, limit), best);
+        
+        return best;
+    }
+    
+private:
+    const std::vector<double>& w_;
+    double sigma_;
+    std::vector<double> y_;
+    std::vector<double> z_;
+    
+    double sse(double a, double d, double c) const {
+        double sum = 0.0;
+        for (size_t i = 0; i < w_.size(); ++i) {
+            double r = a + d * y_[i] + c * z_[i] - w_[i];
+            sum += r * r;
+        }
+        return sum;
+    }
+    
+    void consider(LinearFit fit, LinearFit& best) const {
+        double limit = 4.0 * sigma_;
+        if (!std::isfinite(fit.a) || fit.c < -FEASIBILITY_EPS || fit.c > limit + FEASIBILITY_EPS ||
+            std::abs(fit.d) > fit.c + FEASIBILITY_EPS ||
+            std::abs(fit.d) > limit - fit.c + FEASIBILITY_EPS ||
+            fit.a + std::sqrt(std::max(fit.c * fit.c - fit.d * fit.d, 0.0)) < -FEASIBILITY_EPS) {
+            return;
+        }
+        fit.sse = sse(fit.a, fit.d, fit.c);
+        if (fit.sse < best.sse) {
+            best = fit;
+        }
+    }
+    
+    template <typename Basis, typename Target>
+    std::pair<double, double> fit_affine(Basis basis, Target target) const {
+        double n = static_cast<double>(w_.size());
+        double sg = 0.0, sgg = 0.0, st = 0.0, sgt = 0.0;
+        for (size_t i = 0; i < w_.size(); ++i) {
+            double g = basis(i);
+            double t = target(i);
+            sg += g;
+            sgg += g * g;
+            st += t;
+            sgt += g * t;
+        }
+        double det = n * sgg - sg * sg;
+        if (std::abs(det) < 1e-14 * std::max(1.0, n * sgg)) {
+            return {std::numeric_limits<double>::quiet_NaN(), 0.0};
+        }
+        return {(sgg * st - sg * sgt) / det, (n * sgt - sg * st) / det};
+    }
+    
+    LinearFit fit_level(double d, double c) const {
+        double sum = 0.0;
+        for (size_t i = 0; i < w_.size(); ++i) {
+            sum += w_[i] - d * y_[i] - c * z_[i];
+        }
+        return {sum / w_.size(), d, c, 0.0};
+    }
+    
+    LinearFit unconstrained() const {
+        std::array<std::array<double, 4>, 3> m{};
+        for (size_t i = 0; i < w_.size(); ++i) {
+            std::array<double, 3> g = {1.0, y_[i], z_[i]};
+            for (size_t r = 0; r < 3; ++r) {
+                for (size_t c = 0; c < 3; ++c) {
+                    m[r][c] += g[r] * g[c];
+                }
+                m[r][3] += g[r] * w_[i];
+            }
+        }
+        
+        for (size_t col = 0; col < 3; ++col) {
+            size_t pivot = col;
+            for (size_t row = col + 1; row < 3; ++row) {
+                if (std::abs(m[row][col]) > std::abs(m[pivot][col])) {
+                    pivot = row;
+                }
+            }
+            if (std::abs(m[pivot][col]) < 1e-14) {
+                return {std::numeric_limits<double>::quiet_NaN(), 0.0, 0.0, 0.0};
+            }
+            std::swap(m[col], m[pivot]);
+            for (size_t row = 0; row < 3; ++row) {
+                if (row == col) {
+                    continue;
+                }
+                double factor = m[row][col] / m[col][col];
+                for (size_t k = col; k < 4; ++k) {
+                    m[row][k] -= factor * m[col][k];
+                }
+            }
+        }
+        
+        return {m[0][3] / m[0][0], m[1][3] / m[1][1], m[2][3] / m[2][2], 0.0};
+    }
+};
+
+double clamp_log_sigma(double log_sigma) {
+    return std::clamp(log_sigma, std::log(MIN_SIGMA), std::log(MAX_SIGMA));
+}
+
+double logistic(double x) {
+    return 1.0 / (1.0 + std::exp(-x));
+}
+
+double logit(double p) {
+    p = std::clamp(p, 1e-9, 1.0 - 1e-9);
+    return std::log(p / (1.0 - p));
+}
+
+SSVIParameters ssvi_from(const std::array<double, 3>& x) {
+    double rho = MAX_RHO * std::tanh(x[0]);
+    double eta = 2.0 / (1.0 + std::abs(rho)) * logistic(x[1]);
+    double gamma = 0.5 * logistic(x[2]);
+    return SSVIParameters(rho, eta, gamma);
+}
+
+double ssvi_variance(double rho, double eta, double gamma, double theta, double k) {
+    double phi = eta * std::pow(theta, -gamma);
+    double pk = phi * k;
+    return 0.5 * theta * (1.0 + rho * pk + std::sqrt((pk + rho) * (pk + rho) + 1.0 - rho * rho));
+}
+
+double interpolate_atm(const SliceData& data) {
+    const auto& k = data.log_moneyness;
+    const auto& w = data.total_variance;
+    
+    std::vector<size_t> order(k.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](size_t i, size_t j) { return k[i] < k[j]; });
+    
+    if (k[order.front()] >= 0.0) {
+        return w[order.front()];
+    }
+    if (k[order.back()] <= 0.0) {
+        return w[order.back()];
+    }
+    for (size_t i = 1; i < order.size(); ++i) {
+        size_t hi = order[i];
+        size_t lo = order[i - 1];
+        if (k[hi] >= 0.0) {
+            if (k[hi] == k[lo]) {
+                return w[hi];
+            }
+            double t = -k[lo] / (k[hi] - k[lo]);
+            return w[lo] + t * (w[hi] - w[lo]);
+        }
+    }
+    return w[order.back()];
+}
+
+}
+
+double SVIParameters::total_variance(double log_moneyness) const {
+    double x = log_moneyness - m;
+    return a + b * (rho * x + std::sqrt(x * x + sigma * sigma));
+}
+
+double SVIParameters::implied_vol(double log_moneyness, double time_to_expiry) const {
+    return std::sqrt(std::max(total_variance(log_moneyness), 0.0) / time_to_expiry);
+}
+
+double SSVIParameters::atm_variance(double time_to_expiry) const {
+    if (expiries.empty()) {
+        throw std::logic_error("SSVI surface has no ATM term structure");
+    }
+    if (time_to_expiry <= expiries.front()) {
+        return atm_variances.front() * time_to_expiry / expiries.front();
+    }
+    if (time_to_expiry >= expiries.back()) {
+        return atm_variances.back() * time_to_expiry / expiries.back();
+    }
+    
+    auto it = std::upper_bound(expiries.begin(), expiries.end(), time_to_expiry);
+    size_t i = static_cast<size_t>(it - expiries.begin());
+    double t = (time_to_expiry - expiries[i - 1]) / (expiries[i] - expiries[i - 1]);
+    return atm_variances[i - 1] + t * (atm_variances[i] - atm_variances[i - 1]);
+}
+
+double SSVIParameters::total_variance(double log_moneyness, double time_to_expiry) const {
+    return ssvi_variance(rho, eta, gamma, atm_variance(time_to_expiry), log_moneyness);
+}
+
+double SSVIParameters::implied_vol(double log_moneyness, double time_to_expiry) const {
+    return std::sqrt(total_variance(log_moneyness, time_to_expiry) / time_to_expiry);
+}
+
+SVIFit SVICalibrator::fit_slice(const SmileSlice& slice) const {
+    SliceData data = extract(slice, 3);
+    size_t lowest = static_cast<size_t>(
+        std::min_element(data.total_variance.begin(), data.total_variance.end()) -
+        data.total_variance.begin());
+    return fit_slice_from(slice, SVIParameters(0.0, 0.0, 0.0, data.log_moneyness[lowest], 0.1),
+                          COLD_STEP);
+}
+
+SVIFit SVICalibrator::fit_slice(const SmileSlice& slice, const SVIParameters& warm_start) const {
+    return fit_slice_from(slice, warm_start, WARM_STEP);
+}
+
+SVIFit SVICalibrator::fit_slice_from(
+    const SmileSlice& slice,
+    const SVIParameters& start,
+    double step
+) const {
+    SliceData data = extract(slice, 3);
+    
+    auto objective = [&](const std::array<double, 2>& x) {
+        return QuasiExplicitFit(data, x[0], std::exp(clamp_log_sigma(x[1]))).solve().sse;
+    };
+    
+    std::array<double, 2> x = {start.m, clamp_log_sigma(std::log(std::max(start.sigma, MIN_SIGMA)))};
+    int iterations = nelder_mead(objective, x, step, MAX_ITERATIONS, TOLERANCE);
+    
+    double m = x[0];
+    double sigma = std::exp(clamp_log_sigma(x[1]));
+    LinearFit inner = QuasiExplicitFit(data, m, sigma).solve();
+    
+    SVIParameters params(inner.a, inner.c / sigma, inner.c > 0 ? inner.d / inner.c : 0.0, m, sigma);
+    
+    double sum = 0.0;
+    for (size_t i = 0; i < data.vols.size(); ++i) {
+        double diff = params.implied_vol(data.log_moneyness[i], data.time_to_expiry) - data.vols[i];
+        sum += diff * diff;
+    }
+    
+    return {params, std::sqrt(sum / data.vols.size()), iterations};
+}
+
+std::vector<SVIFit> SVICalibrator::fit_slices(
+    const std::vector<SmileSlice>& slices,
+    const std::vector<SVIParameters>& previous,
+    unsigned num_threads
+) const {
+    if (!previous.empty() && previous.size() != slices.size()) {
+        throw std::invalid_argument("Warm-start parameters must match slice count");
+    }
+    for (const auto& slice : slices) {
+        extract(slice, 3);
+    }
+    
+    std::vector<SVIFit> fits(slices.size(), SVIFit{SVIParameters(), 0.0, 0});
+    detail::parallel_for(slices.size(), num_threads, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            fits[i] = previous.empty() ? fit_slice(slices[i]) : fit_slice(slices[i], previous[i]);
+        }
+    });
+    return fits;
+}
+
+SSVIFit SVICalibrator::fit_surface(const std::vector<SmileSlice>& slices) const {
+    return fit_surface_from(slices, SSVIParameters(), COLD_STEP * 5.0);
+}
+
+SSVIFit SVICalibrator::fit_surface(
+    const std::vector<SmileSlice>& slices,
+    const SSVIParameters& warm_start
+) const {
+    return fit_surface_from(slices, warm_start, WARM_STEP * 5.0);
+}
+
+SSVIFit SVICalibrator::fit_surface_from(
+    const std::vector<SmileSlice>& slices,
+    const SSVIParameters& start,
+    double step
+) const {
+    std::vector<SliceData> data = extract_surface(slices);
+    
+    SSVIParameters params;
+    for (size_t i = 0; i < data.size(); ++i) {
+        double theta = std::max(interpolate_atm(data[i]), 1e-8);
+        if (!params.atm_variances.empty()) {
+            theta = std::max(theta, params.atm_variances.back());
+        }
+        params.expiries.push_back(data[i].time_to_expiry);
+        params.atm_variances.push_back(theta);
+    }
+    
+    auto objective = [&](const std::array<double, 3>& x) {
+        SSVIParameters trial = ssvi_from(x);
+        double sum = 0.0;
+        for (size_t s = 0; s < data.size(); ++s) {
+            double theta = params.atm_variances[s];
+            for (size_t i = 0; i < data[s].log_moneyness.size(); ++i) {
+                double diff = ssvi_variance(trial.rho, trial.eta, trial.gamma, theta,
+                                            data[s].log_moneyness[i]) - data[s].total_variance[i];
+                sum += diff * diff;
+            }
+        }
+        return sum;
+    };
+    
+    double rho = std::clamp(start.rho / MAX_RHO, -0.999999, 0.999999);
+    std::array<double, 3> x = {std::atanh(rho),
+                               logit(start.eta * (1.0 + std::abs(start.rho)) / 2.0),
+                               logit(start.gamma / 0.5)};
+    int iterations = nelder_mead(objective, x, step, MAX_ITERATIONS, TOLERANCE);
+    
+    SSVIParameters fitted = ssvi_from(x);
+    params.rho = fitted.rho;
+    params.eta = fitted.eta;
+    params.gamma = fitted.gamma;
+    
+    double sum = 0.0;
+    size_t count = 0;
+    for (const auto& slice : data) {
+        for (size_t i = 0; i < slice.vols.size(); ++i) {
+            double diff = params.implied_vol(slice.log_moneyness[i], slice.time_to_expiry) - slice.vols[i];
+            sum += diff * diff;
+            ++count;
+        }
+    }
+    
+    return {params, std::sqrt(sum / count), iterations};
+}
+
+std::vector<SSVIFit> SVICalibrator::fit_universe(
+    const std::vector<std::vector<SmileSlice>>& universe,
+    const std::vector<SSVIParameters>& previous,
+    unsigned num_threads
+) const {
+    if (!previous.empty() && previous.size() != universe.size()) {
+        throw std::invalid_argument("Warm-start parameters must match universe size");
+    }
+    for (const auto& slices : universe) {
+        extract_surface(slices);
+    }
+    
+    std::vector<SSVIFit> fits(universe.size(), SSVIFit{SSVIParameters(), 0.0, 0});
+    detail::parallel_for(universe.size(), num_threads, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            fits[i] = previous.empty() ? fit_surface(universe[i]) : fit_surface(universe[i], previous[i]);
+        }
+    });
+    return fits;
+}
+
+}
@@ -0,0 +1,76 @@
+#include "term_structure.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace implied_vol {
+
+ExpiryTermStructure::ExpiryTermStructure(
+    const yield_curve::YieldCurve& curve,
+    double spot,
+    const std::vector<double>& expiries
+) : spot_(spot), expiries_(expiries) {
+    if (spot <= 0) {
+        throw std::invalid_argument("Spot must be positive");
+    }
+    
+    for (size_t i = 0; i < expiries_.size(); ++i) {
+        if (expiries_[i] <= 0 || (i > 0 && expiries_[i] <= expiries_[i - 1])) {
+            throw std::invalid_argument("Expiries must be positive and strictly increasing");
+        }
+    }
+    
+    discount_factors_ = curve.get_discount_factors(expiries_);
+    forwards_.reserve(expiries_.size());
+    rates_.reserve(expiries_.size());
+    
+    for (size_t i = 0; i < expiries_.size(); ++i) {
+        forwards_.push_back(spot_ / discount_factors_[i]);
+        rates_.push_back(-std::log(discount_factors_[i]) / expiries_[i]);
+    }
+}
+
+size_t ExpiryTermStructure::index_of(double expiry) const {
+    auto it = std::lower_bound(expiries_.begin(), expiries_.end(), expiry - 1e-10);
+    if (it == expiries_.end() || std::abs(*it - expiry) > 1e-10) {
+        throw std::out_of_range("Expiry not in term structure");
+    }
+    return static_cast<size_t>(it - expiries_.begin());
+}
+
+OptionSpec ExpiryTermStructure::make_spec(size_t expiry_index, double strike, OptionType type) const {
+    return OptionSpec(spot_, strike, expiries_.at(expiry_index), rates_.at(expiry_index), type);
+}
+
+VolSmile ExpiryTermStructure::compute_vol_smile(
+    ImpliedVolSolver& solver,
+    size_t expiry_index,
+    const std::vector<double>& strikes,
+    const std::vector<double>& market_prices,
+    OptionType type
+) const {
+    return solver.compute_vol_smile(spot_, strikes, market_prices, expiries_.at(expiry_index),
+                                    rates_.at(expiry_index), type);
+}
+
+std::vector<ImpliedVolResult> ExpiryTermStructure::solve_batch(
+    ImpliedVolSolver& solver,
+    const std::vector<size_t>& expiry_indices,
+    const std::vector<double>& strikes,
+    const std::vector<double>& market_prices,
+    const std::vector<OptionType>& types
+) const {
+    if (expiry_indices.size() != strikes.size() || strikes.size() != types.size()) {
+        return {};
+    }
+    
+    std::vector<OptionSpec> specs;
+    specs.reserve(strikes.size());
+    for (size_t i = 0; i < strikes.size(); ++i) {
+        specs.push_back(make_spec(expiry_indices[i], strikes[i], types[i]));
+    }
+    
+    return solver.solve_batch(specs, market_prices);
+}
+
+}
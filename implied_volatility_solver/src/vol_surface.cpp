@@ -0,0 +1,226 @@
+#include "vol_surface.hpp"
+#include <algorithm>
+#include <cmath>
+#include <new>
+#include <stdexcept>
+
+namespace implied_vol {
+
+void VolSurface::AlignedDeleter::operator()(double* p) const {
+    ::operator delete[](p, std::align_val_t(ALIGNMENT));
+}
+
+VolSurface::AlignedArray VolSurface::allocate(size_t count) {
+    return AlignedArray(static_cast<double*>(
+        ::operator new[](count * sizeof(double), std::align_val_t(ALIGNMENT))));
+}
+
+VolSurface::VolSurface(
+    double min_log_moneyness,
+    double max_log_moneyness,
+    size_t num_log_moneyness,
+    const std::vector<double>& expiries,
+    const std::vector<double>& total_variances,
+    SurfaceInterpolation interpolation
+) {
+    if (num_log_moneyness < 2 || max_log_moneyness <= min_log_moneyness) {
+        throw std::invalid_argument("Log-moneyness grid needs at least two increasing points");
+    }
+    
+    if (expiries.empty()) {
+        throw std::invalid_argument("Surface needs at least one expiry");
+    }
+    
+    for (size_t i = 0; i < expiries.size(); ++i) {
+        if (expiries[i] <= 0 || (i > 0 && expiries[i] <= expiries[i - 1])) {
+            throw std::invalid_argument("Expiries must be positive and strictly increasing");
+        }
+    }
+    
+    const size_t num_k = num_log_moneyness;
+    const size_t num_t = expiries.size();
+    if (total_variances.size() != num_k * num_t) {
+        throw std::invalid_argument("Total variance grid size does not match axes");
+    }
+    
+    for (double w : total_variances) {
+        if (!(w >= 0)) {
+            throw std::invalid_argument("Total variance must be non-negative");
+        }
+    }
+    
+    for (size_t i = num_k; i < total_variances.size(); ++i) {
+        if (total_variances[i] < total_variances[i - num_k] - 1e-12) {
+            throw std::invalid_argument("Total variance must be non-decreasing in expiry at every log-moneyness");
+        }
+    }
+    
+    auto grid = std::make_shared<Grid>();
+    grid->k_min = min_log_moneyness;
+    grid->inv_dk = (num_k - 1) / (max_log_moneyness - min_log_moneyness);
+    grid->num_k = num_k;
+    grid->expiries = expiries;
+    grid->interpolation = interpolation;
+    
+    grid->values = allocate(num_k * num_t);
+    std::copy(total_variances.begin(), total_variances.end(), grid->values.get());
+    
+    size_t num_buckets = 4 * num_t;
+    grid->buckets.resize(num_buckets, 0);
+    grid->bucket_scale = (num_t > 1) ? num_buckets / (expiries.back() - expiries.front()) : 0.0;
+    for (size_t b = 0, i = 0; b < num_buckets && num_t > 1; ++b) {
+        double start = expiries.front() + b / grid->bucket_scale;
+        while (i + 2 < num_t && expiries[i + 1] <= start) {
+            ++i;
+        }
+        grid->buckets[b] = i;
+    }
+    
+    if (interpolation == SurfaceInterpolation::CUBIC) {
+        grid->coefficients = allocate(4 * (num_k - 1) * num_t);
+        for (size_t t = 0; t < num_t; ++t) {
+            const double* w = grid->values.get() + t * num_k;
+            double* c = grid->coefficients.get() + 4 * (num_k - 1) * t;
+            
+            auto tangent = [&](size_t j) {
+                if (j == 0) {
+                    return w[1] - w[0];
+                }
+                if (j == num_k - 1) {
+                    return w[j] - w[j - 1];
+                }
+                return 0.5 * (w[j + 1] - w[j - 1]);
+            };
+            
+            for (size_t j = 0; j + 1 < num_k; ++j) {
+                double m0 = tangent(j);
+                double m1 = tangent(j + 1);
+                c[4 * j] = w[j];
+                c[4 * j + 1] = m0;
+                c[4 * j + 2] = 3.0 * (w[j + 1] - w[j]) - 2.0 * m0 - m1;
+                c[4 * j + 3] = 2.0 * (w[j] - w[j + 1]) + m0 + m1;
+            }
+        }
+    }
+    
+    grid_ = std::move(grid);
+}
+
+VolSurface VolSurface::from_ssvi(
+    const SSVIParameters& params,
+    double min_log_moneyness,
+    double max_log_moneyness,
+    size_t num_log_moneyness,
+    SurfaceInterpolation interpolation
+) {
+    std::vector<double> variances;
+    variances.reserve(params.expiries.size() * num_log_moneyness);
+    double dk = (max_log_moneyness - min_log_moneyness) / std::max<size_t>(1, num_log_moneyness - 1);
+    
+    for (double T : params.expiries) {
+        for (size_t j = 0; j < num_log_moneyness; ++j) {
+            variances.push_back(params.total_variance(min_log_moneyness + j * dk, T));
+        }
+    }
+    
+    return VolSurface(min_log_moneyness, max_log_moneyness, num_log_moneyness,
+                      params.expiries, variances, interpolation);
+}
+
+VolSurface VolSurface::from_svi(
+    const std::vector<double>& expiries,
+    const std::vector<SVIParameters>& slices,
+    double min_log_moneyness,
+    double max_log_moneyness,
+    size_t num_log_moneyness,
+    SurfaceInterpolation interpolation
+) {
+    if (expiries.size() != slices.size()) {
+        throw std::invalid_argument("Expiries and SVI slices must have the same size");
+    }
+    
+    std::vector<double> variances;
+    variances.reserve(slices.size() * num_log_moneyness);
+    double dk = (max_log_moneyness - min_log_moneyness) / std::max<size_t>(1, num_log_moneyness - 1);
+    
+    for (const auto& slice : slices) {
+        for (size_t j = 0; j < num_log_moneyness; ++j) {
+            variances.push_back(std::max(0.0, slice.total_variance(min_log_moneyness + j * dk)));
+        }
+    }
+    
+    return VolSurface(min_log_moneyness, max_log_moneyness, num_log_moneyness,
+                      expiries, variances, interpolation);
+}
+
+double VolSurface::row_variance(size_t row, double log_moneyness) const {
+    const Grid& g = *grid_;
+    double x = (log_moneyness - g.k_min) * g.inv_dk;
+    x = std::clamp(x, 0.0, static_cast<double>(g.num_k - 1));
+    size_t j = std::min(static_cast<size_t>(x), g.num_k - 2);
+    double f = x - j;
+    
+    if (g.interpolation == SurfaceInterpolation::CUBIC) {
+        const double* c = g.coefficients.get() + 4 * ((g.num_k - 1) * row + j);
+        return ((c[3] * f + c[2]) * f + c[1]) * f + c[0];
+    }
+    
+    const double* w = g.values.get() + row * g.num_k + j;
+    return w[0] + f * (w[1] - w[0]);
+}
+
+double VolSurface::total_variance(double log_moneyness, double time_to_expiry) const {
+    const Grid& g = *grid_;
+    const std::vector<double>& t = g.expiries;
+    
+    if (time_to_expiry <= t.front()) {
+        return row_variance(0, log_moneyness) * time_to_expiry / t.front();
+    }
+    if (time_to_expiry >= t.back()) {
+        return row_variance(t.size() - 1, log_moneyness) * time_to_expiry / t.back();
+    }
+    
+    size_t bucket = std::min(g.buckets.size() - 1,
+                             static_cast<size_t>((time_to_expiry - t.front()) * g.bucket_scale));
+    size_t i = g.buckets[bucket];
+    while (t[i + 1] < time_to_expiry) {
+        ++i;
+    }
+    
+    double weight = (time_to_expiry - t[i]) / (t[i + 1] - t[i]);
+    double lower = row_variance(i, log_moneyness);
+    double upper = row_variance(i + 1, log_moneyness);
+    return lower + weight * (upper - lower);
+}
+
+double VolSurface::implied_vol(double log_moneyness, double time_to_expiry) const {
+    if (time_to_expiry <= 0) {
+        throw std::invalid_argument("Time to expiry must be positive");
+    }
+    return std::sqrt(std::max(0.0, total_variance(log_moneyness, time_to_expiry)) / time_to_expiry);
+}
+
+std::vector<double> VolSurface::implied_vols(
+    const std::vector<double>& log_moneyness,
+    const std::vector<double>& expiries
+) const {
+    if (log_moneyness.size() != expiries.size()) {
+        throw std::invalid_argument("Query vectors must have the same size");
+    }
+    std::vector<double> out(log_moneyness.size());
+    implied_vols(log_moneyness.data(), expiries.data(), out.data(), out.size());
+    return out;
+}
+
+void VolSurface::implied_vols(
+    const double* log_moneyness,
+    const double* expiries,
+    double* out,
+    size_t count
+) const {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = implied_vol(log_moneyness[i], expiries[i]);
+    }
+}
+
+}
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include "american_approximation.hpp"
+#include "american_pde.hpp"
+#include "black_scholes.hpp"
+#include <cmath>
+#include <vector>
+
+using namespace implied_vol;
+
+TEST(AmericanApproximationTest, MatchesReferencePut) {
+    OptionSpec spec(36.0, 40.0, 1.0, 0.06, OptionType::PUT);
+    AmericanApproximationEngine baw(AmericanApproximation::BARONE_ADESI_WHALEY);
+    AmericanApproximationEngine ju_zhong(AmericanApproximation::JU_ZHONG);
+    
+    EXPECT_NEAR(ju_zhong.price(spec, 0.2), 4.48668, 1e-2);
+    EXPECT_NEAR(baw.price(spec, 0.2), 4.48668, 3e-2);
+    
+    double critical = ju_zhong.critical_price(spec, 0.2);
+    EXPECT_GT(critical, 30.0);
+    EXPECT_LT(critical, 36.0);
+    
+    OptionSpec exercised(critical - 1.0, 40.0, 1.0, 0.06, OptionType::PUT);
+    EXPECT_DOUBLE_EQ(ju_zhong.price(exercised, 0.2), 40.0 - exercised.spot);
+}
+
+TEST(AmericanApproximationTest, AgreesWithPDEAcrossStrikes) {
+    AmericanPDEEngine pde(400, 200, ExerciseStyle::AMERICAN);
+    AmericanApproximationEngine engine;
+    BlackScholesEngine bs;
+    
+    for (double K : {80.0, 95.0, 100.0, 105.0, 120.0}) {
+        for (double T : {0.25, 1.0, 3.0}) {
+            OptionSpec spec(100.0, K, T, 0.05, OptionType::PUT);
+            double price = engine.price(spec, 0.3);
+            double reference = pde.price(spec, 0.3);
+            EXPECT_NEAR(price, reference, 5e-3 * reference + 5e-3) << "K=" << K << " T=" << T;
+            EXPECT_GE(price, bs.price(spec, 0.3) - 1e-12);
+            EXPECT_GE(price, engine.intrinsic_value(spec));
+        }
+    }
+}
+
+TEST(AmericanApproximationTest, CallsAndZeroRateMatchEuropean) {
+    AmericanApproximationEngine engine;
+    BlackScholesEngine bs;
+    
+    OptionSpec call(100.0, 110.0, 1.0, 0.05, OptionType::CALL);
+    EXPECT_DOUBLE_EQ(engine.price(call, 0.25), bs.price(call, 0.25));
+    
+    OptionSpec put(100.0, 110.0, 1.0, 0.0, OptionType::PUT);
+    EXPECT_DOUBLE_EQ(engine.price(put, 0.25), bs.price(put, 0.25));
+}
+
+TEST(AmericanApproximationTest, FusedVegaMatchesPDEVega) {
+    AmericanApproximationEngine engine;
+    AmericanPDEEngine pde(400, 200, ExerciseStyle::AMERICAN);
+    OptionSpec spec(100.0, 105.0, 0.75, 0.04, OptionType::PUT);
+    
+    PriceVega pv = engine.price_and_vega(spec, 0.25);
+    double h = 1e-2;
+    double pde_vega = (pde.price(spec, 0.25 + h) - pde.price(spec, 0.25 - h)) / (2.0 * h);
+    
+    EXPECT_DOUBLE_EQ(pv.price, engine.price(spec, 0.25));
+    EXPECT_NEAR(pv.vega, pde_vega, 5e-3 * pde_vega);
+    
+    BlackScholesEngine bs;
+    PriceVega bs_pv = bs.price_and_vega(spec, 0.25);
+    EXPECT_DOUBLE_EQ(bs_pv.price, bs.price(spec, 0.25));
+    EXPECT_DOUBLE_EQ(bs_pv.vega, bs.vega(spec, 0.25));
+}
+
+TEST(AmericanApproximationTest, AnalyticVegaMatchesPriceDifferences) {
+    for (auto method : {AmericanApproximation::BARONE_ADESI_WHALEY, AmericanApproximation::JU_ZHONG}) {
+        AmericanApproximationEngine engine(method);
+        
+        for (double K : {80.0, 100.0, 120.0}) {
+            for (double T : {0.1, 1.0, 3.0}) {
+                for (double vol : {0.1, 0.25, 0.6}) {
+                    OptionSpec spec(100.0, K, T, 0.05, OptionType::PUT);
+                    double h = 1e-5;
+                    double fd_vega = (engine.price(spec, vol + h) - engine.price(spec, vol - h)) / (2.0 * h);
+                    
+                    PriceVega pv = engine.price_and_vega(spec, vol);
+                    EXPECT_DOUBLE_EQ(pv.price, engine.price(spec, vol));
+                    EXPECT_NEAR(pv.vega, fd_vega, 2e-3 * fd_vega + 1e-6)
+                        << "K=" << K << " T=" << T << " vol=" << vol;
+                }
+            }
+        }
+    }
+}
+
+TEST(AmericanApproximationTest, ImpliedVolRoundTrip) {
+    AmericanImpliedVolSolver solver(AmericanApproximationEngine(AmericanApproximation::JU_ZHONG));
+    
+    for (double K : {85.0, 100.0, 105.0}) {
+        for (double vol : {0.15, 0.35, 0.6}) {
+            OptionSpec spec(100.0, K, 0.5, 0.05, OptionType::PUT);
+            double market = solver.engine().price(spec, vol);
+            
+            ImpliedVolResult result = solver.solve_with_fallback(spec, market);
+            ASSERT_TRUE(result.is_success()) << "K=" << K << " vol=" << vol;
+            EXPECT_NEAR(result.implied_vol, vol, 1e-5);
+        }
+    }
+}
@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+#include "american_pde.hpp"
+#include "black_scholes.hpp"
+#include <cmath>
+#include <vector>
+
+using namespace implied_vol;
+
+TEST(AmericanPDETest, TridiagonalSolverMatchesSystem) {
+    TridiagonalSolver solver;
+    solver.factor(-1.0, 4.0, -2.0, 6);
+    
+    std::vector<double> rhs = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+    std::vector<double> x(6);
+    solver.solve(rhs.data(), x.data());
+    
+    for (size_t i = 0; i < 6; ++i) {
+        double lhs = 4.0 * x[i];
+        if (i > 0) lhs -= x[i - 1];
+        if (i < 5) lhs -= 2.0 * x[i + 1];
+        EXPECT_NEAR(lhs, rhs[i], 1e-12);
+    }
+    
+    std::vector<double> obstacle(6, 3.0);
+    solver.solve_projected(rhs.data(), obstacle.data(), true, x.data());
+    for (double v : x) {
+        EXPECT_GE(v, 3.0);
+    }
+}
+
+TEST(AmericanPDETest, EuropeanModeMatchesBlackScholes) {
+    AmericanPDEEngine engine(400, 200, ExerciseStyle::EUROPEAN);
+    BlackScholesEngine bs;
+    
+    for (auto type : {OptionType::CALL, OptionType::PUT}) {
+        for (double K : {80.0, 100.0, 120.0}) {
+            OptionSpec spec(100.0, K, 1.0, 0.05, type);
+            EXPECT_NEAR(engine.price(spec, 0.25), bs.price(spec, 0.25), 5e-3);
+        }
+    }
+}
+
+TEST(AmericanPDETest, AmericanPutMatchesReference) {
+    AmericanPDEEngine engine(400, 200);
+    
+    OptionSpec put(36.0, 40.0, 1.0, 0.06, OptionType::PUT);
+    EXPECT_NEAR(engine.price(put, 0.2), 4.48668, 1e-3);
+    EXPECT_GT(engine.price(put, 0.2), BlackScholesEngine().price(put, 0.2) + 0.5);
+    
+    OptionSpec call(36.0, 40.0, 1.0, 0.06, OptionType::CALL);
+    EXPECT_NEAR(engine.price(call, 0.2), BlackScholesEngine().price(call, 0.2), 5e-3);
+}
+
+TEST(AmericanPDETest, ImpliedVolRoundTrip) {
+    AmericanPDEEngine engine;
+    
+    std::vector<OptionSpec> specs;
+    std::vector<double> prices;
+    std::vector<double> vols;
+    for (double K : {80.0, 90.0, 100.0, 110.0, 120.0}) {
+        OptionSpec spec(100.0, K, 0.75, 0.04, OptionType::PUT);
+        double vol = 0.2 + 0.001 * (K - 100.0);
+        specs.push_back(spec);
+        vols.push_back(vol);
+        prices.push_back(engine.price(spec, vol));
+    }
+    
+    std::vector<ImpliedVolResult> results = engine.implied_vol_batch(specs, prices, 3);
+    ASSERT_EQ(results.size(), specs.size());
+    
+    for (size_t i = 0; i < specs.size(); ++i) {
+        ASSERT_TRUE(results[i].is_success()) << results[i].status_string();
+        EXPECT_NEAR(results[i].implied_vol, vols[i], 1e-5);
+        EXPECT_LE(results[i].iterations, 8);
+        
+        ImpliedVolResult single = engine.implied_vol(specs[i], prices[i]);
+        EXPECT_DOUBLE_EQ(single.implied_vol, results[i].implied_vol);
+    }
+    
+    std::vector<double> batch = engine.price_batch(specs, vols, 2);
+    for (size_t i = 0; i < specs.size(); ++i) {
+        EXPECT_DOUBLE_EQ(batch[i], prices[i]);
+    }
+}
+
+TEST(AmericanPDETest, RejectsInvalidInput) {
+    AmericanPDEEngine engine;
+    OptionSpec put(100.0, 120.0, 1.0, 0.05, OptionType::PUT);
+    
+    EXPECT_THROW(AmericanPDEEngine(2, 100), std::invalid_argument);
+    EXPECT_THROW(engine.price(put, 0.0), std::invalid_argument);
+    EXPECT_THROW(engine.price(OptionSpec(100.0, 100.0, 0.0, 0.0, OptionType::PUT), 0.2), std::invalid_argument);
+    EXPECT_EQ(engine.implied_vol(put, 19.0).status, ConvergenceStatus::PRICE_OUT_OF_BOUNDS);
+    EXPECT_EQ(engine.implied_vol(put, -1.0).status, ConvergenceStatus::INVALID_INPUT);
+    EXPECT_TRUE(engine.implied_vol_batch({put}, {}).empty());
+}
@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+#include "dual.hpp"
+#include "black_scholes.hpp"
+#include <cmath>
+
+using namespace implied_vol;
+
+TEST(DualTest, ElementaryDerivatives) {
+    using D = Dual<double, 2>;
+    D x = D::variable(0.7, 0);
+    D y = D::variable(1.3, 1);
+    
+    D f = exp(x * y) / y + log(x) * sqrt(y) - 2.0 * x;
+    
+    double fx = y.value() * std::exp(0.7 * 1.3) / 1.3 + std::sqrt(1.3) / 0.7 - 2.0;
+    double fy = (0.7 * 1.3 - 1.0) * std::exp(0.7 * 1.3) / (1.3 * 1.3) + std::log(0.7) * 0.5 / std::sqrt(1.3);
+    
+    EXPECT_NEAR(f.value(), std::exp(0.91) / 1.3 + std::log(0.7) * std::sqrt(1.3) - 1.4, 1e-14);
+    EXPECT_NEAR(f.derivative(0), fx, 1e-12);
+    EXPECT_NEAR(f.derivative(1), fy, 1e-12);
+}
+
+TEST(DualTest, HyperDualSecondDerivatives) {
+    HyperDual<2> x = hyper_variable<2>(0.4, 0);
+    HyperDual<2> y = hyper_variable<2>(2.0, 1);
+    
+    HyperDual<2> f = x * x * y + exp(x * y);
+    
+    double e = std::exp(0.8);
+    EXPECT_NEAR(value_of(f), 0.32 + e, 1e-14);
+    EXPECT_NEAR(f.value().derivative(0), 2.0 * 0.4 * 2.0 + 2.0 * e, 1e-12);
+    EXPECT_NEAR(f.derivative(0).derivative(0), 2.0 * 2.0 + 4.0 * e, 1e-12);
+    EXPECT_NEAR(f.derivative(0).derivative(1), 2.0 * 0.4 + e + 0.8 * e, 1e-12);
+    EXPECT_NEAR(f.derivative(1).derivative(0), f.derivative(0).derivative(1), 1e-12);
+    EXPECT_NEAR(f.derivative(1).derivative(1), 0.16 * e, 1e-12);
+}
+
+TEST(DualTest, BlackScholesGreeksInOnePass) {
+    BlackScholesEngine engine;
+    
+    for (auto type : {OptionType::CALL, OptionType::PUT}) {
+        OptionSpec spec(100.0, 105.0, 0.75, 0.03, type);
+        double vol = 0.22;
+        
+        BlackScholesSensitivities s = compute_sensitivities(spec, vol);
+        using S = BlackScholesSensitivities;
+        
+        EXPECT_NEAR(s.price, engine.price(spec, vol), 1e-12);
+        EXPECT_NEAR(s.gradient[S::SPOT], engine.delta(spec, vol), 1e-6);
+        EXPECT_NEAR(s.gradient[S::VOLATILITY], engine.vega(spec, vol), 1e-4);
+        EXPECT_NEAR(s.gradient[S::TIME], -engine.theta(spec, vol), 1e-4);
+        EXPECT_NEAR(s.gradient[S::RATE], engine.rho(spec, vol), 1e-4);
+        EXPECT_NEAR(s.hessian[S::SPOT][S::SPOT], engine.gamma(spec, vol), 1e-6);
+        
+        for (size_t i = 0; i < S::NUM_INPUTS; ++i) {
+            for (size_t j = 0; j < S::NUM_INPUTS; ++j) {
+                EXPECT_NEAR(s.hessian[i][j], s.hessian[j][i], 1e-10);
+            }
+        }
+        
+        double h = 1e-4;
+        double vanna = (engine.delta(spec, vol + h) - engine.delta(spec, vol - h)) / (2.0 * h);
+        double volga = (engine.vega(spec, vol + h) - engine.vega(spec, vol - h)) / (2.0 * h);
+        EXPECT_NEAR(s.hessian[S::SPOT][S::VOLATILITY], vanna, 1e-4);
+        EXPECT_NEAR(s.hessian[S::VOLATILITY][S::VOLATILITY], volga, 1e-2);
+    }
+}
+
+TEST(DualTest, DualInstantiationMatchesDouble) {
+    using D = Dual<double, 1>;
+    BlackScholesEngine engine;
+    BasicBlackScholesEngine<D> dual_engine;
+    
+    OptionSpec spec(95.0, 100.0, 0.5, 0.02, OptionType::PUT);
+    BasicOptionSpec<D> dual_spec(D(95.0), D(100.0), D(0.5), D(0.02), OptionType::PUT);
+    D vol = D::variable(0.3, 0);
+    
+    BasicPriceVega<D> pv = dual_engine.price_and_vega(dual_spec, vol);
+    EXPECT_DOUBLE_EQ(pv.price.value(), engine.price(spec, 0.3));
+    EXPECT_DOUBLE_EQ(pv.vega.value(), engine.vega(spec, 0.3));
+    EXPECT_NEAR(pv.price.derivative(0), pv.vega.value(), 1e-4);
+    EXPECT_DOUBLE_EQ(dual_engine.intrinsic_value(dual_spec).value(), 5.0);
+}
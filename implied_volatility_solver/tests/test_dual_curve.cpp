@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+#include "black_scholes.hpp"
+#include "dual.hpp"
+#include "discount_factor.hpp"
+#include "interpolation.hpp"
+#include <cmath>
+#include <vector>
+
+using namespace implied_vol;
+
+TEST(DualCurveTest, NodeSensitivities) {
+    using D = Dual<double, 3>;
+    std::vector<double> times = {0.5, 1.0, 2.0};
+    std::vector<double> rates = {0.01, 0.02, 0.03};
+    
+    std::vector<D> dual_rates;
+    for (size_t i = 0; i < rates.size(); ++i) {
+        dual_rates.push_back(D::variable(rates[i], i));
+    }
+    
+    std::vector<double> dfs = yield_curve::DiscountFactor::from_zero_rates(
+        times, rates, yield_curve::CompoundingType::CONTINUOUS);
+    std::vector<D> dual_dfs;
+    for (size_t i = 0; i < times.size(); ++i) {
+        dual_dfs.push_back(yield_curve::BasicDiscountFactor<D>::from_zero_rate(
+            D(times[i]), dual_rates[i], yield_curve::CompoundingType::CONTINUOUS));
+    }
+    
+    yield_curve::FlatForwardInterpolator interp;
+    yield_curve::BasicFlatForwardInterpolator<D> dual_interp;
+    double t = 1.5;
+    D df = dual_interp.interpolate(t, times, dual_dfs);
+    
+    EXPECT_DOUBLE_EQ(df.value(), interp.interpolate(t, times, dfs));
+    EXPECT_NEAR(df.derivative(0), 0.0, 1e-14);
+    EXPECT_NEAR(df.derivative(1), -0.5 * df.value(), 1e-12);
+    EXPECT_NEAR(df.derivative(2), -1.0 * df.value(), 1e-12);
+    
+    BasicBlackScholesEngine<D> engine;
+    D rate = -log(df) / t;
+    BasicOptionSpec<D> spec(D(100.0), D(100.0), D(t), rate, OptionType::CALL);
+    D price = engine.price(spec, D(0.2));
+    
+    double rho = BlackScholesEngine().rho(OptionSpec(100.0, 100.0, t, rate.value(), OptionType::CALL), 0.2);
+    EXPECT_NEAR(price.derivative(1), rho * 0.5 / t, 1e-4);
+    EXPECT_NEAR(price.derivative(2), rho * 1.0 / t, 1e-4);
+}
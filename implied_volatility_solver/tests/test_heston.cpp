@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+#include "heston.hpp"
+#include "black_scholes.hpp"
+#include <cmath>
+#include <vector>
+
+using namespace implied_vol;
+
+class HestonTest : public ::testing::Test {
+protected:
+    HestonEngine engine;
+    HestonParameters params{0.0175, 1.5768, 0.0398, 0.5751, -0.5711};
+};
+
+TEST_F(HestonTest, MatchesReferencePrice) {
+    OptionSpec spec(100.0, 100.0, 1.0, 0.0, OptionType::CALL);
+    EXPECT_NEAR(engine.price(params, spec), 5.785155450, 1e-6);
+}
+
+TEST_F(HestonTest, DegeneratesToBlackScholes) {
+    HestonParameters flat(0.04, 2.0, 0.04, 1e-3, 0.0);
+    BlackScholesEngine bs;
+    
+    std::vector<double> strikes = {80.0, 90.0, 100.0, 110.0, 120.0};
+    std::vector<double> prices = engine.price_strip(flat, 100.0, 0.5, 0.03, strikes, OptionType::CALL);
+    
+    ASSERT_EQ(prices.size(), strikes.size());
+    for (size_t i = 0; i < strikes.size(); ++i) {
+        OptionSpec spec(100.0, strikes[i], 0.5, 0.03, OptionType::CALL);
+        EXPECT_NEAR(prices[i], bs.price(spec, 0.2), 1e-4);
+    }
+}
+
+TEST_F(HestonTest, StripSatisfiesPutCallParity) {
+    std::vector<double> strikes = {70.0, 85.0, 100.0, 115.0, 130.0};
+    double T = 2.0;
+    double r = 0.04;
+    
+    std::vector<double> calls = engine.price_strip(params, 100.0, T, r, strikes, OptionType::CALL);
+    std::vector<double> puts = engine.price_strip(params, 100.0, T, r, strikes, OptionType::PUT);
+    
+    for (size_t i = 0; i < strikes.size(); ++i) {
+        EXPECT_NEAR(calls[i] - puts[i], 100.0 - strikes[i] * std::exp(-r * T), 1e-8);
+        OptionSpec spec(100.0, strikes[i], T, r, OptionType::CALL);
+        EXPECT_NEAR(calls[i], engine.price(params, spec), 1e-10);
+    }
+}
+
+TEST_F(HestonTest, CalibrationRecoversParameters) {
+    HestonParameters truth(0.04, 1.5, 0.06, 0.5, -0.7);
+    double spot = 100.0;
+    double r = 0.02;
+    
+    std::vector<HestonQuote> quotes;
+    for (double T : {0.25, 0.5, 1.0, 2.0}) {
+        std::vector<double> strikes = {80.0, 90.0, 95.0, 100.0, 105.0, 110.0, 120.0};
+        std::vector<double> prices = engine.price_strip(truth, spot, T, r, strikes, OptionType::CALL);
+        for (size_t i = 0; i < strikes.size(); ++i) {
+            quotes.emplace_back(T, strikes[i], prices[i], OptionType::CALL);
+        }
+    }
+    
+    HestonCalibrator calibrator(engine, spot, r);
+    HestonCalibrationResult result = calibrator.calibrate(
+        quotes, HestonParameters(0.02, 1.0, 0.03, 0.3, -0.3), 4);
+    
+    EXPECT_TRUE(result.converged);
+    EXPECT_LT(result.rms_error, 1e-5);
+    EXPECT_NEAR(result.parameters.v0, truth.v0, 1e-3);
+    EXPECT_NEAR(result.parameters.theta, truth.theta, 5e-3);
+    EXPECT_NEAR(result.parameters.rho, truth.rho, 2e-2);
+}
+
+TEST_F(HestonTest, RejectsInvalidInput) {
+    OptionSpec spec(100.0, 100.0, 1.0, 0.0, OptionType::CALL);
+    EXPECT_THROW(engine.price(HestonParameters(0.04, 1.0, 0.04, 0.5, 1.2), spec), std::invalid_argument);
+    EXPECT_THROW(engine.price(HestonParameters(0.04, -1.0, 0.04, 0.5, 0.0), spec), std::invalid_argument);
+    EXPECT_THROW(HestonEngine(1), std::invalid_argument);
+    
+    HestonCalibrator calibrator(engine, 100.0, 0.0);
+    EXPECT_THROW(calibrator.calibrate({}, params), std::invalid_argument);
+}
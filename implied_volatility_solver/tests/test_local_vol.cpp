@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+#include "local_vol.hpp"
+#include <cmath>
+#include <vector>
+
+using namespace implied_vol;
+
+class LocalVolTest : public ::testing::Test {
+protected:
+    SSVIParameters params{-0.4, 1.2, 0.35};
+    
+    void SetUp() override {
+        params.expiries = {0.25, 0.5, 1.0, 2.0};
+        params.atm_variances = {0.011, 0.021, 0.04, 0.078};
+    }
+};
+
+TEST_F(LocalVolTest, FlatSlicesGiveForwardVols) {
+    std::vector<double> slice_expiries = {0.5, 1.0};
+    std::vector<SVIParameters> slices = {SVIParameters(0.04 * 0.5, 0.0), SVIParameters(0.04 * 0.5 + 0.09 * 0.5, 0.0)};
+    
+    LocalVolBuilder builder(100.0, 0.03);
+    LocalVolSurface surface = builder.build(slice_expiries, slices, 50.0, 150.0, 11, {0.25, 0.75, 1.5});
+    
+    for (size_t j = 0; j < surface.num_strikes(); ++j) {
+        EXPECT_NEAR(surface.row(0)[j], 0.2, 1e-12);
+        EXPECT_NEAR(surface.row(1)[j], 0.3, 1e-12);
+    }
+    EXPECT_EQ(surface.clamped_nodes(), 0u);
+}
+
+TEST_F(LocalVolTest, MatchesFiniteDifferenceDupire) {
+    double spot = 100.0;
+    double r = 0.02;
+    
+    LocalVolBuilder builder(spot, r);
+    LocalVolSurface surface = builder.build(params, 60.0, 160.0, 101, {0.4, 0.8, 1.5});
+    
+    const double h = 1e-4;
+    for (size_t t = 0; t < surface.expiries().size(); ++t) {
+        double T = surface.expiries()[t];
+        for (size_t j = 10; j < surface.num_strikes(); j += 20) {
+            double y = std::log(surface.strike(j) / (spot * std::exp(r * T)));
+            double w = params.total_variance(y, T);
+            double wk = (params.total_variance(y + h, T) - params.total_variance(y - h, T)) / (2 * h);
+            double wkk = (params.total_variance(y + h, T) - 2 * w + params.total_variance(y - h, T)) / (h * h);
+            double wt = (params.total_variance(y, T + h) - params.total_variance(y, T - h)) / (2 * h);
+            
+            double expected = std::sqrt(LocalVolBuilder::dupire_variance(y, w, wk, wkk, wt));
+            EXPECT_NEAR(surface.row(t)[j], expected, 1e-5);
+        }
+    }
+}
+
+TEST_F(LocalVolTest, ParallelMatchesSerial) {
+    std::vector<double> expiries;
+    for (int i = 1; i <= 40; ++i) {
+        expiries.push_back(0.05 * i);
+    }
+    
+    LocalVolSurface serial = LocalVolBuilder(100.0, 0.01, 1).build(params, 50.0, 200.0, 301, expiries);
+    LocalVolSurface parallel = LocalVolBuilder(100.0, 0.01, 4).build(params, 50.0, 200.0, 301, expiries);
+    
+    ASSERT_EQ(serial.data().size(), 301u * 40u);
+    EXPECT_EQ(serial.data(), parallel.data());
+    EXPECT_EQ(serial.clamped_nodes(), parallel.clamped_nodes());
+}
+
+TEST_F(LocalVolTest, LookupInterpolatesGrid) {
+    LocalVolSurface surface(50.0, 150.0, 3, {1.0, 2.0}, {0.1, 0.2, 0.3, 0.3, 0.4, 0.5});
+    
+    EXPECT_DOUBLE_EQ(surface.local_vol(100.0, 1.0), 0.2);
+    EXPECT_DOUBLE_EQ(surface.local_vol(125.0, 2.0), 0.45);
+    EXPECT_DOUBLE_EQ(surface.local_vol(100.0, 1.5), 0.3);
+    EXPECT_DOUBLE_EQ(surface.local_vol(10.0, 0.1), 0.1);
+    EXPECT_DOUBLE_EQ(surface.local_vol(500.0, 9.0), 0.5);
+}
+
+TEST_F(LocalVolTest, RejectsInvalidInput) {
+    LocalVolBuilder builder(100.0, 0.0);
+    SSVIParameters empty;
+    
+    EXPECT_THROW(LocalVolBuilder(0.0, 0.0), std::invalid_argument);
+    EXPECT_THROW(builder.build(empty, 50.0, 150.0, 10, {1.0}), std::invalid_argument);
+    EXPECT_THROW(builder.build(params, 150.0, 50.0, 10, {1.0}), std::invalid_argument);
+    EXPECT_THROW(builder.build(params, 50.0, 150.0, 10, {1.0, 0.5}), std::invalid_argument);
+    EXPECT_THROW(builder.build({1.0}, {}, 50.0, 150.0, 10, {1.0}), std::invalid_argument);
+}
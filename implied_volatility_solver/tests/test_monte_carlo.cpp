@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include "monte_carlo.hpp"
+#include "philox.hpp"
+#include "black_scholes.hpp"
+#include <cmath>
+
+using namespace implied_vol;
+
+TEST(MonteCarloTest, PhiloxKnownAnswers) {
+    Philox4x32 zero(0);
+    Philox4x32::Counter r = zero({0, 0, 0, 0});
+    EXPECT_EQ(r[0], 0x6627e8d5u);
+    EXPECT_EQ(r[1], 0xe169c58du);
+    EXPECT_EQ(r[2], 0xbc57ac4cu);
+    EXPECT_EQ(r[3], 0x9b00dbd8u);
+    
+    Philox4x32 ones(~0ull);
+    r = ones({0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu});
+    EXPECT_EQ(r[0], 0x408f276du);
+    EXPECT_EQ(r[1], 0x41c83b0eu);
+    EXPECT_EQ(r[2], 0xa20bc7c6u);
+    EXPECT_EQ(r[3], 0x6d5451fdu);
+}
+
+TEST(MonteCarloTest, EuropeanMatchesBlackScholes) {
+    OptionSpec spec(100.0, 105.0, 1.0, 0.03, OptionType::CALL);
+    BlackScholesEngine bs;
+    double exact = bs.price(spec, 0.25);
+    
+    MonteCarloSettings settings;
+    settings.num_paths = 200000;
+    settings.control_variate = false;
+    MonteCarloResult plain = MonteCarloEngine(settings).price(spec, 0.25);
+    
+    EXPECT_NEAR(plain.price, exact, 4.0 * plain.standard_error);
+    EXPECT_EQ(plain.num_paths, 200000u);
+    
+    settings.control_variate = true;
+    MonteCarloResult controlled = MonteCarloEngine(settings).price(spec, 0.25);
+    EXPECT_NEAR(controlled.price, exact, 1e-6);
+    EXPECT_NEAR(controlled.control_beta, 1.0, 1e-9);
+}
+
+TEST(MonteCarloTest, PathDependentPayoffs) {
+    OptionSpec spec(100.0, 100.0, 1.0, 0.05, OptionType::CALL);
+    BlackScholesEngine bs;
+    double vanilla = bs.price(spec, 0.2);
+    
+    MonteCarloSettings settings;
+    settings.num_paths = 100000;
+    settings.num_steps = 50;
+    MonteCarloEngine engine(settings);
+    
+    MonteCarloResult asian = engine.price(spec, 0.2, PathPayoff(PathPayoffType::ASIAN));
+    MonteCarloResult lookback = engine.price(spec, 0.2, PathPayoff(PathPayoffType::LOOKBACK));
+    MonteCarloResult out = engine.price(spec, 0.2, PathPayoff(PathPayoffType::UP_AND_OUT, 130.0));
+    MonteCarloResult in = engine.price(spec, 0.2, PathPayoff(PathPayoffType::UP_AND_IN, 130.0));
+    
+    double n = 50.0;
+    double mean = std::log(100.0) + (0.05 - 0.02) * (n + 1.0) / (2.0 * n);
+    double var = 0.04 * (n + 1.0) * (2.0 * n + 1.0) / (6.0 * n * n);
+    double d1 = (mean - std::log(100.0) + var) / std::sqrt(var);
+    double geometric = std::exp(-0.05) * (std::exp(mean + 0.5 * var) * 0.5 * std::erfc(-d1 / std::sqrt(2.0)) -
+                                          100.0 * 0.5 * std::erfc(-(d1 - std::sqrt(var)) / std::sqrt(2.0)));
+    
+    EXPECT_GT(asian.price, geometric);
+    EXPECT_LT(asian.price, geometric + 0.3);
+    EXPECT_LT(asian.price, vanilla);
+    EXPECT_GT(lookback.price, vanilla);
+    EXPECT_NEAR(out.price + in.price, vanilla, 1e-6);
+    EXPECT_LT(asian.standard_error, 0.02);
+}
+
+TEST(MonteCarloTest, DeterministicAcrossThreadCounts) {
+    OptionSpec spec(100.0, 95.0, 0.5, 0.01, OptionType::PUT);
+    
+    MonteCarloSettings settings;
+    settings.num_paths = 50001;
+    settings.num_steps = 12;
+    settings.num_threads = 1;
+    MonteCarloResult serial = MonteCarloEngine(settings).price(spec, 0.3, PathPayoff(PathPayoffType::DOWN_AND_OUT, 80.0));
+    
+    settings.num_threads = 7;
+    MonteCarloResult parallel = MonteCarloEngine(settings).price(spec, 0.3, PathPayoff(PathPayoffType::DOWN_AND_OUT, 80.0));
+    
+    EXPECT_DOUBLE_EQ(serial.price, parallel.price);
+    EXPECT_DOUBLE_EQ(serial.standard_error, parallel.standard_error);
+    EXPECT_EQ(serial.num_paths, 50002u);
+}
+
+TEST(MonteCarloTest, RejectsInvalidInput) {
+    MonteCarloSettings settings;
+    settings.num_paths = 0;
+    EXPECT_THROW(MonteCarloEngine{settings}, std::invalid_argument);
+    
+    MonteCarloEngine engine;
+    OptionSpec spec(100.0, 100.0, 1.0, 0.0, OptionType::CALL);
+    EXPECT_THROW(engine.price(spec, 0.0), std::invalid_argument);
+    EXPECT_THROW(engine.price(spec, 0.2, PathPayoff(PathPayoffType::UP_AND_OUT)), std::invalid_argument);
+    EXPECT_THROW(engine.price(OptionSpec(100.0, 100.0, 0.0, 0.0, OptionType::CALL), 0.2), std::invalid_argument);
+}
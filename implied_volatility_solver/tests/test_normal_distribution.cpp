@@ -37,3 +37,10 @@ TEST(NormalDistributionTest, CDFBounds) {
     EXPECT_NEAR(NormalDistribution::cdf(-5.0), 0.0, 1e-6);
     EXPECT_NEAR(NormalDistribution::cdf(5.0), 1.0, 1e-6);
 }
+
+TEST(NormalDistributionTest, InverseCDFKnownValues) {
+    EXPECT_NEAR(NormalDistribution::inverse_cdf(0.5), 0.0, 1e-12);
+    EXPECT_NEAR(NormalDistribution::inverse_cdf(0.975), 1.959963985, 1e-8);
+    EXPECT_NEAR(NormalDistribution::inverse_cdf(0.001), -3.090232306, 1e-8);
+    EXPECT_NEAR(NormalDistribution::inverse_cdf(0.8413447460685429), 1.0, 1e-8);
+}
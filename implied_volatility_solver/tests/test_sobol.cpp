@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+#include "sobol.hpp"
+#include "monte_carlo.hpp"
+#include <cmath>
+#include <vector>
+
+using namespace implied_vol;
+
+TEST(SobolTest, FirstPointsMatchReference) {
+    SobolSequence sobol(3);
+    std::vector<double> expected = {
+        0.5, 0.5, 0.5,
+        0.75, 0.25, 0.25,
+        0.25, 0.75, 0.75,
+        0.375, 0.375, 0.625,
+        0.875, 0.875, 0.125,
+    };
+    
+    std::vector<double> point(3);
+    for (size_t n = 0; n < 5; ++n) {
+        sobol.next(point.data());
+        for (size_t d = 0; d < 3; ++d) {
+            EXPECT_DOUBLE_EQ(point[d], expected[3 * n + d]);
+        }
+    }
+}
+
+TEST(SobolTest, SkipAheadMatchesSequentialAndIsBalanced) {
+    const size_t dim = SobolSequence::MAX_DIMENSION;
+    SobolSequence sequential(dim);
+    std::vector<double> point(dim);
+    std::vector<double> sums(dim, 0.0);
+    
+    for (size_t n = 0; n < 1023; ++n) {
+        sequential.next(point.data());
+        for (size_t d = 0; d < dim; ++d) {
+            sums[d] += point[d];
+        }
+    }
+    for (size_t d = 0; d < dim; ++d) {
+        EXPECT_DOUBLE_EQ(sums[d], 511.5);
+    }
+    
+    SobolSequence skipped(dim, 1023);
+    std::vector<double> jumped(dim);
+    sequential.next(point.data());
+    skipped.next(jumped.data());
+    EXPECT_EQ(point, jumped);
+    EXPECT_EQ(skipped.index(), 1024u);
+}
+
+TEST(SobolTest, BrownianBridgeHasBrownianCovariance) {
+    std::vector<double> times = {0.1, 0.25, 0.5, 0.6, 1.0, 1.7, 2.0};
+    const size_t n = times.size();
+    BrownianBridge bridge(times);
+    
+    std::vector<std::vector<double>> paths(n, std::vector<double>(n));
+    for (size_t k = 0; k < n; ++k) {
+        std::vector<double> unit(n, 0.0);
+        unit[k] = 1.0;
+        bridge.build_increments(unit.data(), paths[k].data());
+        for (size_t i = 1; i < n; ++i) {
+            paths[k][i] += paths[k][i - 1];
+        }
+    }
+    
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            double cov = 0.0;
+            for (size_t k = 0; k < n; ++k) {
+                cov += paths[k][i] * paths[k][j];
+            }
+            EXPECT_NEAR(cov, std::min(times[i], times[j]), 1e-12);
+        }
+    }
+    EXPECT_NEAR(paths[0][n - 1], std::sqrt(2.0), 1e-12);
+}
+
+TEST(SobolTest, QuasiRandomImprovesAsianConvergence) {
+    OptionSpec spec(100.0, 100.0, 1.0, 0.05, OptionType::CALL);
+    PathPayoff asian(PathPayoffType::ASIAN);
+    
+    MonteCarloSettings settings;
+    settings.num_steps = 16;
+    settings.antithetic = false;
+    settings.control_variate = false;
+    settings.sampling = SamplingMethod::SOBOL_BRIDGE;
+    settings.num_paths = 1 << 18;
+    double reference = MonteCarloEngine(settings).price(spec, 0.2, asian).price;
+    
+    settings.num_paths = 1 << 13;
+    double bridge_error = std::abs(MonteCarloEngine(settings).price(spec, 0.2, asian).price - reference);
+    
+    settings.num_threads = 3;
+    double threaded_error = std::abs(MonteCarloEngine(settings).price(spec, 0.2, asian).price - reference);
+    EXPECT_DOUBLE_EQ(bridge_error, threaded_error);
+    
+    settings.sampling = SamplingMethod::PSEUDO_RANDOM;
+    MonteCarloResult pseudo = MonteCarloEngine(settings).price(spec, 0.2, asian);
+    
+    EXPECT_LT(bridge_error, 0.01);
+    EXPECT_LT(bridge_error, pseudo.standard_error);
+}
+
+TEST(SobolTest, RejectsInvalidInput) {
+    EXPECT_THROW(SobolSequence(0), std::invalid_argument);
+    EXPECT_THROW(SobolSequence(SobolSequence::MAX_DIMENSION + 1), std::invalid_argument);
+    EXPECT_THROW(BrownianBridge(std::vector<double>{}), std::invalid_argument);
+    EXPECT_THROW(BrownianBridge(std::vector<double>{0.5, 0.5}), std::invalid_argument);
+    
+    MonteCarloSettings settings;
+    settings.num_steps = SobolSequence::MAX_DIMENSION + 1;
+    settings.sampling = SamplingMethod::SOBOL;
+    EXPECT_THROW(MonteCarloEngine{settings}, std::invalid_argument);
+}
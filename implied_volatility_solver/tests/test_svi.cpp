@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+#include "svi.hpp"
+#include <cmath>
+#include <vector>
+
+using namespace implied_vol;
+
+class SVITest : public ::testing::Test {
+protected:
+    SVICalibrator calibrator;
+    SVIParameters raw{0.02, 0.12, -0.4, 0.05, 0.15};
+    SSVIParameters ssvi{-0.5, 1.0, 0.4};
+    
+    void SetUp() override {
+        ssvi.expiries = {1.0};
+        ssvi.atm_variances = {0.04};
+    }
+    
+    SmileSlice raw_slice() const {
+        VolSmile smile;
+        for (double K = 60.0; K <= 150.0; K += 5.0) {
+            smile.add_point(K, std::sqrt(raw.total_variance(std::log(K / 100.0))), ConvergenceStatus::SUCCESS);
+        }
+        return SmileSlice(1.0, 100.0, smile);
+    }
+    
+    std::vector<SmileSlice> ssvi_surface(double forward) const {
+        std::vector<SmileSlice> slices;
+        for (double T : {0.25, 0.5, 1.0, 2.0}) {
+            VolSmile smile;
+            for (double K = 60.0; K <= 150.0; K += 5.0) {
+                double k = std::log(K / forward);
+                smile.add_point(K, std::sqrt(ssvi.total_variance(k, T) / T), ConvergenceStatus::SUCCESS);
+            }
+            slices.push_back(SmileSlice(T, forward, smile));
+        }
+        return slices;
+    }
+};
+
+TEST_F(SVITest, RecoversRawParameters) {
+    SVIFit fit = calibrator.fit_slice(raw_slice());
+    
+    EXPECT_LT(fit.rms_error, 1e-6);
+    EXPECT_NEAR(fit.parameters.a, 0.02, 1e-4);
+    EXPECT_NEAR(fit.parameters.b, 0.12, 1e-4);
+    EXPECT_NEAR(fit.parameters.rho, -0.4, 1e-3);
+    EXPECT_NEAR(fit.parameters.m, 0.05, 1e-3);
+    EXPECT_NEAR(fit.parameters.sigma, 0.15, 1e-3);
+}
+
+TEST_F(SVITest, IgnoresFailedPointsAndWarmStarts) {
+    SmileSlice slice = raw_slice();
+    slice.smile.add_point(155.0, 3.0, ConvergenceStatus::MAX_ITERATIONS_REACHED);
+    
+    SVIFit cold = calibrator.fit_slice(slice);
+    EXPECT_LT(cold.rms_error, 1e-6);
+    
+    SVIFit warm = calibrator.fit_slice(slice, cold.parameters);
+    EXPECT_LT(warm.rms_error, 1e-6);
+    EXPECT_LT(warm.iterations, cold.iterations);
+}
+
+TEST_F(SVITest, SSVIRecoversSurface) {
+    SSVIFit fit = calibrator.fit_surface(ssvi_surface(100.0));
+    
+    EXPECT_LT(fit.rms_error, 1e-4);
+    EXPECT_NEAR(fit.parameters.rho, -0.5, 1e-2);
+    EXPECT_NEAR(fit.parameters.eta, 1.0, 2e-2);
+    EXPECT_NEAR(fit.parameters.gamma, 0.4, 2e-2);
+    EXPECT_NEAR(fit.parameters.atm_variance(1.0), 0.04, 1e-4);
+    EXPECT_LE(fit.parameters.eta * (1.0 + std::abs(fit.parameters.rho)), 2.0);
+}
+
+TEST_F(SVITest, UniverseMatchesSerialFits) {
+    std::vector<std::vector<SmileSlice>> universe;
+    for (int i = 0; i < 8; ++i) {
+        universe.push_back(ssvi_surface(80.0 + 5.0 * i));
+    }
+    
+    std::vector<SSVIFit> fits = calibrator.fit_universe(universe, {}, 4);
+    ASSERT_EQ(fits.size(), universe.size());
+    
+    std::vector<SSVIParameters> previous;
+    for (size_t i = 0; i < fits.size(); ++i) {
+        SSVIFit serial = calibrator.fit_surface(universe[i]);
+        EXPECT_DOUBLE_EQ(fits[i].parameters.rho, serial.parameters.rho);
+        EXPECT_DOUBLE_EQ(fits[i].parameters.eta, serial.parameters.eta);
+        previous.push_back(fits[i].parameters);
+    }
+    
+    std::vector<SSVIFit> refits = calibrator.fit_universe(universe, previous, 4);
+    for (size_t i = 0; i < refits.size(); ++i) {
+        EXPECT_LT(refits[i].rms_error, 1e-4);
+        EXPECT_LE(refits[i].iterations, fits[i].iterations);
+    }
+}
+
+TEST_F(SVITest, RejectsInvalidInput) {
+    VolSmile sparse;
+    sparse.add_point(100.0, 0.2, ConvergenceStatus::SUCCESS);
+    
+    EXPECT_THROW(calibrator.fit_slice(SmileSlice(1.0, 100.0, sparse)), std::invalid_argument);
+    EXPECT_THROW(calibrator.fit_slice(SmileSlice(0.0, 100.0, sparse)), std::invalid_argument);
+    EXPECT_THROW(calibrator.fit_surface({}), std::invalid_argument);
+    EXPECT_THROW(calibrator.fit_universe({ssvi_surface(100.0)}, {SSVIParameters(), SSVIParameters()}),
+                 std::invalid_argument);
+}
@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+#include "term_structure.hpp"
+#include "black_scholes.hpp"
+#include <cmath>
+
+using namespace implied_vol;
+
+class TermStructureTest : public ::testing::Test {
+protected:
+    yield_curve::YieldCurve curve{yield_curve::CompoundingType::CONTINUOUS,
+                                  yield_curve::InterpolationType::FLAT_FORWARD};
+    
+    void SetUp() override {
+        curve.add_point(0.0, 1.0);
+        curve.add_point(0.5, std::exp(-0.01 * 0.5));
+        curve.add_point(1.0, std::exp(-0.02 * 1.0));
+        curve.add_point(2.0, std::exp(-0.03 * 2.0));
+    }
+};
+
+TEST_F(TermStructureTest, CachesDiscountFactorsAndForwards) {
+    ExpiryTermStructure terms(curve, 100.0, {0.25, 1.0, 1.5});
+    
+    ASSERT_EQ(terms.size(), 3u);
+    for (size_t i = 0; i < terms.size(); ++i) {
+        double T = terms.expiries()[i];
+        double df = curve.get_discount_factor(T);
+        EXPECT_DOUBLE_EQ(terms.discount_factor(i), df);
+        EXPECT_NEAR(terms.forward(i), 100.0 / df, 1e-10);
+        EXPECT_NEAR(std::exp(-terms.rate(i) * T), df, 1e-14);
+    }
+    EXPECT_EQ(terms.index_of(1.0), 1u);
+    EXPECT_THROW(terms.index_of(0.75), std::out_of_range);
+}
+
+TEST_F(TermStructureTest, SmileRecoversVolatilityUnderCurveDiscounting) {
+    ExpiryTermStructure terms(curve, 100.0, {0.5, 1.0, 2.0});
+    BlackScholesEngine engine;
+    ImpliedVolSolver solver;
+    
+    std::vector<double> strikes = {80.0, 90.0, 100.0, 110.0, 120.0};
+    for (size_t e = 0; e < terms.size(); ++e) {
+        std::vector<double> prices;
+        for (double K : strikes) {
+            double df = curve.get_discount_factor(terms.expiries()[e]);
+            OptionSpec spec(100.0, K, terms.expiries()[e], -std::log(df) / terms.expiries()[e],
+                            OptionType::CALL);
+            prices.push_back(engine.price(spec, 0.25));
+        }
+        
+        VolSmile smile = terms.compute_vol_smile(solver, e, strikes, prices);
+        for (size_t i = 0; i < strikes.size(); ++i) {
+            EXPECT_EQ(smile.statuses[i], ConvergenceStatus::SUCCESS);
+            EXPECT_NEAR(smile.implied_vols[i], 0.25, 1e-5);
+        }
+    }
+}
+
+TEST_F(TermStructureTest, BatchSolvesAcrossExpiries) {
+    ExpiryTermStructure terms(curve, 100.0, {0.5, 1.0, 2.0});
+    BlackScholesEngine engine;
+    ImpliedVolSolver solver;
+    
+    std::vector<size_t> expiries = {0, 1, 2, 2};
+    std::vector<double> strikes = {95.0, 105.0, 90.0, 115.0};
+    std::vector<OptionType> types = {OptionType::CALL, OptionType::PUT, OptionType::PUT, OptionType::CALL};
+    std::vector<double> vols = {0.2, 0.3, 0.35, 0.18};
+    std::vector<double> prices;
+    for (size_t i = 0; i < strikes.size(); ++i) {
+        prices.push_back(engine.price(terms.make_spec(expiries[i], strikes[i], types[i]), vols[i]));
+    }
+    
+    std::vector<ImpliedVolResult> results = terms.solve_batch(solver, expiries, strikes, prices, types);
+    
+    ASSERT_EQ(results.size(), vols.size());
+    for (size_t i = 0; i < vols.size(); ++i) {
+        EXPECT_TRUE(results[i].is_success());
+        EXPECT_NEAR(results[i].implied_vol, vols[i], 1e-5);
+    }
+    EXPECT_THROW(ExpiryTermStructure(curve, 100.0, {1.0, 0.5}), std::invalid_argument);
+}
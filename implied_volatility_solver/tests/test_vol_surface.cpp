@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include "vol_surface.hpp"
+#include <cmath>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace implied_vol;
+
+class VolSurfaceTest : public ::testing::Test {
+protected:
+    SSVIParameters params{-0.4, 1.2, 0.35};
+    
+    void SetUp() override {
+        params.expiries = {0.1, 0.25, 0.5, 1.0, 2.0, 5.0};
+        params.atm_variances = {0.005, 0.011, 0.021, 0.04, 0.078, 0.19};
+    }
+};
+
+TEST_F(VolSurfaceTest, ReproducesGridNodes) {
+    std::vector<double> expiries = {0.5, 1.0};
+    std::vector<double> variances = {0.03, 0.02, 0.025, 0.05, 0.04, 0.045};
+    
+    for (auto interp : {SurfaceInterpolation::BILINEAR, SurfaceInterpolation::CUBIC}) {
+        VolSurface surface(-0.5, 0.5, 3, expiries, variances, interp);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(surface.data()) % VolSurface::ALIGNMENT, 0u);
+        for (size_t t = 0; t < 2; ++t) {
+            for (size_t j = 0; j < 3; ++j) {
+                EXPECT_NEAR(surface.total_variance(-0.5 + 0.5 * j, expiries[t]), variances[3 * t + j], 1e-15);
+            }
+        }
+        EXPECT_NEAR(surface.total_variance(0.0, 0.75), 0.5 * (0.02 + 0.04), 1e-15);
+    }
+}
+
+TEST_F(VolSurfaceTest, InterpolatesSSVISurface) {
+    VolSurface bilinear = VolSurface::from_ssvi(params, -1.0, 1.0, 201);
+    VolSurface cubic = VolSurface::from_ssvi(params, -1.0, 1.0, 201, SurfaceInterpolation::CUBIC);
+    
+    double bilinear_error = 0.0;
+    double cubic_error = 0.0;
+    for (double T : params.expiries) {
+        for (double k = -0.9; k <= 0.9; k += 0.0137) {
+            double exact = params.implied_vol(k, T);
+            bilinear_error = std::max(bilinear_error, std::abs(bilinear.implied_vol(k, T) - exact));
+            cubic_error = std::max(cubic_error, std::abs(cubic.implied_vol(k, T) - exact));
+        }
+    }
+    
+    EXPECT_LT(bilinear_error, 1e-4);
+    EXPECT_LT(cubic_error, 1e-6);
+    
+    double blended = 0.6 * params.total_variance(0.1, 0.5) + 0.4 * params.total_variance(0.1, 1.0);
+    EXPECT_NEAR(cubic.total_variance(0.1, 0.7), blended, 1e-7);
+}
+
+TEST_F(VolSurfaceTest, ExtrapolatesFlat) {
+    VolSurface surface = VolSurface::from_ssvi(params, -1.0, 1.0, 101);
+    
+    EXPECT_DOUBLE_EQ(surface.implied_vol(0.0, 0.05), surface.implied_vol(0.0, 0.1));
+    EXPECT_DOUBLE_EQ(surface.implied_vol(0.0, 10.0), surface.implied_vol(0.0, 5.0));
+    EXPECT_DOUBLE_EQ(surface.total_variance(3.0, 1.0), surface.total_variance(1.0, 1.0));
+    EXPECT_DOUBLE_EQ(surface.total_variance(-3.0, 1.0), surface.total_variance(-1.0, 1.0));
+}
+
+TEST_F(VolSurfaceTest, BatchAndSharedSnapshots) {
+    VolSurface surface = VolSurface::from_ssvi(params, -1.0, 1.0, 101, SurfaceInterpolation::CUBIC);
+    
+    std::vector<double> ks;
+    std::vector<double> ts;
+    for (int i = 0; i < 1000; ++i) {
+        ks.push_back(-1.2 + 0.0024 * i);
+        ts.push_back(0.05 + 0.006 * i);
+    }
+    
+    std::vector<double> batch = surface.implied_vols(ks, ts);
+    
+    std::vector<std::vector<double>> results(4);
+    std::vector<std::thread> pool;
+    for (size_t t = 0; t < results.size(); ++t) {
+        VolSurface snapshot = surface;
+        pool.emplace_back([snapshot, &ks, &ts, &results, t] {
+            results[t] = snapshot.implied_vols(ks, ts);
+        });
+    }
+    for (auto& thread : pool) {
+        thread.join();
+    }
+    
+    for (size_t i = 0; i < ks.size(); ++i) {
+        EXPECT_DOUBLE_EQ(batch[i], surface.implied_vol(ks[i], ts[i]));
+        for (const auto& result : results) {
+            EXPECT_DOUBLE_EQ(result[i], batch[i]);
+        }
+    }
+}
+
+TEST_F(VolSurfaceTest, RejectsCalendarArbitrage) {
+    EXPECT_NO_THROW(VolSurface(-0.5, 0.5, 2, {0.5, 1.0}, {0.02, 0.03, 0.02, 0.035}));
+    EXPECT_THROW(VolSurface(-0.5, 0.5, 2, {0.5, 1.0}, {0.02, 0.03, 0.025, 0.029}), std::invalid_argument);
+    
+    std::vector<SVIParameters> slices = {
+        SVIParameters(0.04, 0.1, -0.5, 0.0, 0.1),
+        SVIParameters(0.07, 0.02, 0.0, 0.0, 0.1)
+    };
+    EXPECT_NO_THROW(VolSurface::from_svi({0.5, 1.0}, slices, -0.1, 0.1, 5));
+    EXPECT_THROW(VolSurface::from_svi({0.5, 1.0}, slices, -1.0, 1.0, 21), std::invalid_argument);
+}
+
+TEST_F(VolSurfaceTest, RejectsInvalidInput) {
+    EXPECT_THROW(VolSurface(0.0, 1.0, 1, {1.0}, {0.04}), std::invalid_argument);
+    EXPECT_THROW(VolSurface(0.0, 1.0, 2, {1.0, 0.5}, {0.04, 0.04, 0.04, 0.04}), std::invalid_argument);
+    EXPECT_THROW(VolSurface(0.0, 1.0, 2, {1.0}, {0.04}), std::invalid_argument);
+    EXPECT_THROW(VolSurface(0.0, 1.0, 2, {1.0}, {0.04, -0.01}), std::invalid_argument);
+    
+    VolSurface surface(0.0, 1.0, 2, {1.0}, {0.04, 0.04});
+    EXPECT_THROW(surface.implied_vol(0.5, 0.0), std::invalid_argument);
+    EXPECT_THROW(surface.implied_vols({0.1}, {}), std::invalid_argument);
+}
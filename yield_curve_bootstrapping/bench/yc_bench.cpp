@@ -0,0 +1,384 @@
+#include "alloc_counter.hpp"
+#include "bond_universe.hpp"
+#include "bootstrapper.hpp"
+#include "bspline_fitter.hpp"
+#include "fixed_tenor_curve.hpp"
+#include "forward_curve.hpp"
+#include "multi_curve.hpp"
+#include "schedule.hpp"
+#include "swap_portfolio.hpp"
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#ifndef YC_BENCH_VERSION
+#define YC_BENCH_VERSION "unknown"
+#endif
+
+using namespace yield_curve;
+
+namespace {
+
+volatile double g_sink = 0.0;
+
+struct BenchResult {
+    std::string name;
+    size_t iterations;
+    double ns_per_op;
+    double allocs_per_op;
+};
+
+struct BenchConfig {
+    std::string format = "table";
+    std::string filter;
+    double min_time = 0.2;
+};
+
+class BenchRunner {
+public:
+    explicit BenchRunner(const BenchConfig& config) : config_(config) {}
+
+    void run(const std::string& name, const std::function<void()>& op) {
+        if (!config_.filter.empty() && name.find(config_.filter) == std::string::npos) {
+            return;
+        }
+
+        op();
+
+        size_t iterations = 1;
+        double elapsed = 0.0;
+        size_t allocations = 0;
+
+        while (true) {
+            size_t alloc_start = allocation_count();
+            auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < iterations; ++i) {
+                op();
+            }
+            auto end = std::chrono::steady_clock::now();
+            allocations = allocation_count() - alloc_start;
+            elapsed = std::chrono::duration<double>(end - start).count();
+
+            if (elapsed >= config_.min_time || iterations >= (size_t(1) << 30)) {
+                break;
+            }
+
+            double scale = elapsed > 0 ? 1.5 * config_.min_time / elapsed : 10.0;
+            iterations = static_cast<size_t>(iterations * std::min(std::max(scale, 2.0), 100.0));
+        }
+
+        results_.push_back({name, iterations, elapsed * 1e9 / iterations,
+                            static_cast<double>(allocations) / iterations});
+    }
+
+    void report() const {
+        if (config_.format == "csv") {
+            std::cout << "version,benchmark,iterations,ns_per_op,allocs_per_op\n";
+            for (const auto& r : results_) {
+                std::cout << YC_BENCH_VERSION << "," << r.name << "," << r.iterations << ","
+                          << std::fixed << std::setprecision(2) << r.ns_per_op << ","
+                          << r.allocs_per_op << "\n";
+            }
+        } else if (config_.format == "json") {
+            std::cout << "{\n  \"version\": \"" << YC_BENCH_VERSION << "\",\n  \"benchmarks\": [\n";
+            for (size_t i = 0; i < results_.size(); ++i) {
+                const auto& r = results_[i];
+                std::cout << "    {\"name\": \"" << r.name << "\", \"iterations\": " << r.iterations
+                          << ", \"ns_per_op\": " << std::fixed << std::setprecision(2) << r.ns_per_op
+                          << ", \"allocs_per_op\": " << r.allocs_per_op << "}"
+                          << (i + 1 < results_.size() ? "," : "") << "\n";
+            }
+            std::cout << "  ]\n}\n";
+        } else {
+            std::cout << "yc_bench " << YC_BENCH_VERSION << "\n";
+            std::cout << std::left << std::setw(44) << "Benchmark" << std::right
+                      << std::setw(14) << "ns/op" << std::setw(14) << "allocs/op"
+                      << std::setw(14) << "iterations" << "\n";
+            std::cout << std::string(86, '-') << "\n";
+            for (const auto& r : results_) {
+                std::cout << std::left << std::setw(44) << r.name << std::right << std::fixed
+                          << std::setprecision(1) << std::setw(14) << r.ns_per_op
+                          << std::setprecision(2) << std::setw(14) << r.allocs_per_op
+                          << std::setw(14) << r.iterations << "\n";
+            }
+        }
+    }
+
+private:
+    BenchConfig config_;
+    std::vector<BenchResult> results_;
+};
+
+double reference_df(double t) {
+    return std::exp(-0.02 * t - 0.0004 * t * t);
+}
+
+std::vector<BondData> make_bonds(size_t count) {
+    std::vector<BondData> bonds;
+    bonds.reserve(count);
+
+    for (size_t k = 1; k <= count; ++k) {
+        BondData bond(0.25 * k, 0.03, 4, 100.0);
+        std::vector<double> times = bond.get_payment_times();
+        std::vector<double> cfs = bond.get_cash_flows();
+        double price = 0.0;
+        for (size_t i = 0; i < times.size(); ++i) {
+            price += cfs[i] * reference_df(times[i]);
+        }
+        bond.market_price = price;
+        bonds.push_back(bond);
+    }
+
+    return bonds;
+}
+
+std::vector<double> make_grid(double t_max, size_t count) {
+    std::vector<double> grid(count);
+    for (size_t i = 0; i < count; ++i) {
+        grid[i] = t_max * (i + 1) / count;
+    }
+    return grid;
+}
+
+std::string interp_name(InterpolationType type) {
+    switch (type) {
+        case InterpolationType::LINEAR:
+            return "linear";
+        case InterpolationType::LOG_LINEAR:
+            return "log_linear";
+        case InterpolationType::FLAT_FORWARD:
+            return "flat_forward";
+        default:
+            return "unknown";
+    }
+}
+
+void add_multi_curve_instruments(MultiCurveBuilder& builder) {
+    size_t ois = builder.add_curve("OIS");
+    size_t m3 = builder.add_curve("3M");
+    size_t m6 = builder.add_curve("6M");
+    const double tenors[] = {2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 12.0, 15.0, 20.0, 25.0, 30.0};
+
+    builder.add_instrument(RateInstrument::deposit(ois, 0.25, 0.020));
+    builder.add_instrument(RateInstrument::ois_swap(ois, 1.0, 0.021));
+    builder.add_instrument(RateInstrument::deposit(m3, 0.25, 0.023));
+    builder.add_instrument(RateInstrument::future(m3, 0.25, 0.5, 97.6));
+    builder.add_instrument(RateInstrument::future(m3, 0.5, 0.75, 97.55));
+    builder.add_instrument(RateInstrument::future(m3, 0.75, 1.0, 97.5));
+    builder.add_instrument(RateInstrument::deposit(m6, 0.5, 0.025));
+    builder.add_instrument(RateInstrument::fra(m6, 0.5, 1.0, 0.026));
+
+    for (double tenor : tenors) {
+        double rate = 0.022 + 0.0004 * tenor;
+        builder.add_instrument(RateInstrument::ois_swap(ois, tenor, rate));
+        builder.add_instrument(RateInstrument::swap(ois, m3, tenor, rate + 0.002, 1, 4));
+        builder.add_instrument(RateInstrument::swap(ois, m6, tenor, rate + 0.003, 1, 2));
+    }
+}
+
+BenchConfig parse_args(int argc, char** argv) {
+    BenchConfig config;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg.rfind("--format=", 0) == 0) {
+            config.format = arg.substr(9);
+        } else if (arg.rfind("--filter=", 0) == 0) {
+            config.filter = arg.substr(9);
+        } else if (arg.rfind("--min-time=", 0) == 0) {
+            config.min_time = std::stod(arg.substr(11));
+        } else {
+            std::cerr << "Usage: yc_bench [--format=table|csv|json] [--filter=substr] [--min-time=sec]\n";
+            std::exit(arg == "--help" ? 0 : 1);
+        }
+    }
+
+    return config;
+}
+
+}
+
+int main(int argc, char** argv) {
+    BenchConfig config = parse_args(argc, argv);
+    BenchRunner runner(config);
+
+    const std::vector<InterpolationType> interp_types = {
+        InterpolationType::LINEAR,
+        InterpolationType::LOG_LINEAR,
+        InterpolationType::FLAT_FORWARD
+    };
+
+    for (auto type : interp_types) {
+        for (size_t count : {10, 40, 160}) {
+            std::vector<BondData> bonds = make_bonds(count);
+            Bootstrapper bootstrapper(CompoundingType::CONTINUOUS, type);
+            runner.run("bootstrap/" + interp_name(type) + "/" + std::to_string(count), [&] {
+                YieldCurve curve = bootstrapper.bootstrap(bonds);
+                g_sink = g_sink + curve.discount_factors().back();
+            });
+        }
+    }
+
+    std::vector<BondData> bonds = make_bonds(40);
+    std::vector<double> grid = make_grid(10.0, 1000);
+
+    for (auto type : interp_types) {
+        YieldCurve curve = Bootstrapper(CompoundingType::CONTINUOUS, type).bootstrap(bonds);
+        std::string suffix = interp_name(type);
+
+        double t = 0.0;
+        runner.run("discount_factor/single/" + suffix, [&] {
+            t = (t > 9.9) ? 0.013 : t + 0.731;
+            g_sink = g_sink + curve.get_discount_factor(t);
+        });
+
+        runner.run("discount_factor/batch_1000/" + suffix, [&] {
+            std::vector<double> dfs = curve.get_discount_factors(grid);
+            g_sink = g_sink + dfs.back();
+        });
+
+        ForwardCurve forward_curve(curve);
+        runner.run("forward_curve/1000/" + suffix, [&] {
+            std::vector<double> fwds = forward_curve.get_forward_curve(grid);
+            g_sink = g_sink + fwds.back();
+        });
+
+        runner.run("instantaneous_forward/1000/" + suffix, [&] {
+            std::vector<double> fwds = forward_curve.get_instantaneous_forward_curve(grid);
+            g_sink = g_sink + fwds.back();
+        });
+
+        runner.run("has_arbitrage/40/" + suffix, [&] {
+            g_sink = g_sink + (curve.has_arbitrage() ? 1.0 : 0.0);
+        });
+    }
+
+    StandardTenorCurve fixed_curve = StandardTenorCurve::from_curve(
+        Bootstrapper(CompoundingType::CONTINUOUS, InterpolationType::FLAT_FORWARD).bootstrap(bonds));
+    double fixed_t = 0.0;
+    runner.run("fixed_tenor/discount_factor/single", [&] {
+        fixed_t = (fixed_t > 9.9) ? 0.013 : fixed_t + 0.731;
+        g_sink = g_sink + fixed_curve.get_discount_factor(fixed_t);
+    });
+
+    std::vector<double> fixed_out(grid.size());
+    runner.run("fixed_tenor/discount_factor/batch_1000", [&] {
+        fixed_curve.get_discount_factors(grid.data(), fixed_out.data(), grid.size());
+        g_sink = g_sink + fixed_out.back();
+    });
+
+    Bootstrapper bootstrapper(CompoundingType::CONTINUOUS, InterpolationType::LOG_LINEAR);
+
+    runner.run("spline/fit/40", [&] {
+        YieldCurve curve = bootstrapper.bootstrap(bonds);
+        curve.apply_cubic_spline_smoothing();
+        g_sink = g_sink + curve.get_discount_factor(5.0);
+    });
+
+    YieldCurve smoothed = bootstrapper.bootstrap_with_spline(bonds);
+    runner.run("spline/eval_batch_1000", [&] {
+        std::vector<double> dfs = smoothed.get_discount_factors(grid);
+        g_sink = g_sink + dfs.back();
+    });
+
+    runner.run("zero_rates/batch_1000", [&] {
+        std::vector<double> rates = smoothed.get_zero_rates(grid);
+        g_sink = g_sink + rates.back();
+    });
+
+    std::vector<BondData> universe = make_bonds(160);
+    std::vector<double> breakpoints = {0.0, 1.0, 2.0, 3.0, 5.0, 7.0, 10.0, 15.0, 20.0, 30.0, 40.0};
+    std::vector<double> prices;
+    for (const auto& bond : universe) {
+        prices.push_back(bond.market_price);
+    }
+
+    runner.run("bspline/fit/160", [&] {
+        BSplineCurveFitter fitter(breakpoints, 1e-3);
+        fitter.fit(universe);
+        g_sink = g_sink + fitter.coefficients().back();
+    });
+
+    BSplineCurveFitter fitter(breakpoints, 1e-3);
+    fitter.fit(universe);
+    runner.run("bspline/refit_prices/160", [&] {
+        fitter.refit_prices(prices);
+        g_sink = g_sink + fitter.coefficients().back();
+    });
+
+    MultiCurveBuilder multi_curve;
+    add_multi_curve_instruments(multi_curve);
+    multi_curve.build();
+
+    std::vector<double> base_quotes;
+    for (const auto& instrument : multi_curve.instruments()) {
+        base_quotes.push_back(instrument.quote);
+    }
+
+    runner.run("multi_curve/build/3x" + std::to_string(base_quotes.size()), [&] {
+        MultiCurveBuilder builder;
+        add_multi_curve_instruments(builder);
+        builder.build();
+        g_sink = g_sink + builder.get_discount_factor(1, 10.0);
+    });
+
+    std::vector<double> quotes = base_quotes;
+    size_t tick = 0;
+    runner.run("multi_curve/rebuild/3x" + std::to_string(base_quotes.size()), [&] {
+        double bump = (++tick % 2 == 0) ? 1e-5 : -1e-5;
+        for (size_t i = 0; i < quotes.size(); ++i) {
+            quotes[i] = base_quotes[i] + (multi_curve.instruments()[i].type == RateInstrumentType::FUTURE
+                                          ? -100.0 * bump : bump);
+        }
+        multi_curve.update_quotes(quotes);
+        g_sink = g_sink + multi_curve.get_discount_factor(1, 10.0);
+    });
+
+    SwapPortfolio swaps;
+    for (size_t i = 0; i < 200000; ++i) {
+        swaps.add(SwapData(1e6, 0.02 + 1e-7 * i, 1.0 + (i % 30), 1, (i % 3 == 0) ? 2 : 4,
+                           (i % 2) ? SwapDirection::PAYER : SwapDirection::RECEIVER));
+    }
+    YieldCurve ois_curve = multi_curve.curve(0);
+    YieldCurve projection_curve = multi_curve.curve(1);
+
+    runner.run("swap_portfolio/value/200000", [&] {
+        std::vector<double> values = swaps.value(ois_curve, projection_curve);
+        g_sink = g_sink + values.back();
+    });
+
+    BondUniverse bond_universe(CompoundingType::SEMI_ANNUAL);
+    for (size_t i = 0; i < 10000; ++i) {
+        bond_universe.add(BondData(0.5 + 0.5 * (i % 60), 0.01 + 0.0005 * (i % 80), 2,
+                                   95.0 + 0.001 * i));
+    }
+
+    runner.run("bond_universe/ytm/10000", [&] {
+        std::vector<double> yields = bond_universe.yield_to_maturity();
+        g_sink = g_sink + yields.back();
+    });
+
+    runner.run("bond_universe/z_spread/10000", [&] {
+        std::vector<double> spreads = bond_universe.z_spread(ois_curve);
+        g_sink = g_sink + spreads.back();
+    });
+
+    HolidayCalendar target = HolidayCalendar::target(2000, 2080);
+    ScheduleGenerator schedule_generator(target);
+    CouponSchedule coupon_schedule;
+    int schedule_offset = 0;
+
+    runner.run("schedule/generate/10y_semi_annual", [&] {
+        schedule_offset = (schedule_offset + 1) % 3650;
+        Date effective = Date(2024, 1, 1).add_days(schedule_offset);
+        schedule_generator.generate(effective, effective.add_months(120), 2, coupon_schedule);
+        g_sink = g_sink + coupon_schedule.accruals.back();
+    });
+
+    runner.report();
+    return 0;
+}
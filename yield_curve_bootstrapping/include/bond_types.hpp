@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace yield_curve {
@@ -14,6 +15,8 @@ enum class CompoundingType {
 
 std::string compounding_type_string(CompoundingType type);
 
+std::vector<double> payment_schedule(double start, double maturity, int frequency);
+
 struct BondData {
     double maturity;
     double coupon_rate;
@@ -29,6 +32,52 @@ struct BondData {
     std::vector<double> get_cash_flows() const;
 };
 
+enum class ExerciseType {
+    CALL,
+    PUT
+};
+
+struct ExerciseRight {
+    double time;
+    double price;
+    ExerciseType type;
+    
+    ExerciseRight(double t, double px, ExerciseType ex_type)
+        : time(t), price(px), type(ex_type) {}
+};
+
+struct CallableBond {
+    BondData bond;
+    std::vector<ExerciseRight> schedule;
+    
+    CallableBond(const BondData& b, std::vector<ExerciseRight> rights = {})
+        : bond(b), schedule(std::move(rights)) {}
+};
+
+enum class SwapDirection {
+    PAYER,
+    RECEIVER
+};
+
+struct SwapData {
+    double notional;
+    double fixed_rate;
+    double maturity;
+    int fixed_frequency;
+    int float_frequency;
+    SwapDirection direction;
+    double start;
+    double float_spread;
+    
+    SwapData(double n, double rate, double mat, int fixed_freq = 1, int float_freq = 4,
+             SwapDirection dir = SwapDirection::PAYER, double start_time = 0.0, double spread = 0.0)
+        : notional(n), fixed_rate(rate), maturity(mat), fixed_frequency(fixed_freq),
+          float_frequency(float_freq), direction(dir), start(start_time), float_spread(spread) {}
+    
+    std::vector<double> get_fixed_payment_times() const;
+    std::vector<double> get_float_payment_times() const;
+};
+
 struct CurvePoint {
     double time;
     double discount_factor;
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "bond_types.hpp"
+#include "yield_curve.hpp"
+#include <cstddef>
+#include <vector>
+
+namespace yield_curve {
+
+class BondUniverse {
+public:
+    explicit BondUniverse(CompoundingType yield_compounding = CompoundingType::CONTINUOUS);
+    
+    size_t add(const BondData& bond);
+    
+    std::vector<double> price_from_yield(const std::vector<double>& yields) const;
+    
+    std::vector<double> yield_to_maturity() const;
+    
+    std::vector<double> yield_to_maturity(const std::vector<double>& prices) const;
+    
+    std::vector<double> z_spread(const YieldCurve& curve) const;
+    
+    std::vector<double> z_spread(const YieldCurve& curve, const std::vector<double>& prices) const;
+    
+    const std::vector<double>& market_prices() const { return prices_; }
+    
+    size_t size() const { return prices_.size(); }
+    
+    size_t num_cash_flows() const { return times_.size(); }
+    
+private:
+    static constexpr double TOLERANCE = 1e-12;
+    static constexpr double MIN_RATE = -1.0;
+    static constexpr double MAX_RATE = 5.0;
+    static constexpr int MAX_ITERATIONS = 100;
+    
+    CompoundingType yield_compounding_;
+    std::vector<size_t> offsets_;
+    std::vector<double> times_;
+    std::vector<double> cash_flows_;
+    std::vector<double> prices_;
+    std::vector<double> initial_yields_;
+    
+    std::vector<double> solve_rates(
+        const std::vector<double>& weights,
+        const std::vector<double>& prices,
+        const std::vector<double>& guesses
+    ) const;
+    
+    double to_continuous(double yield) const;
+    
+    double from_continuous(double rate) const;
+    
+    void check_size(const std::vector<double>& values) const;
+};
+
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "bond_types.hpp"
+#include "yield_curve.hpp"
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace yield_curve {
+
+class BSplineBasis {
+public:
+    static constexpr int DEGREE = 3;
+
+    explicit BSplineBasis(const std::vector<double>& breakpoints);
+
+    size_t size() const { return knots_.size() - DEGREE - 1; }
+
+    double t_min() const { return knots_.front(); }
+    double t_max() const { return knots_.back(); }
+
+    size_t evaluate(double t, std::array<double, DEGREE + 1>& values) const;
+
+    size_t second_derivative(double t, std::array<double, DEGREE + 1>& values) const;
+
+    const std::vector<double>& breakpoints() const { return breakpoints_; }
+
+private:
+    std::vector<double> breakpoints_;
+    std::vector<double> knots_;
+
+    size_t find_span(double t) const;
+};
+
+class BandedCholesky {
+public:
+    BandedCholesky() = default;
+
+    void factorize(std::vector<double> band, size_t n, size_t bandwidth);
+
+    void solve(std::vector<double>& rhs) const;
+
+    size_t size() const { return n_; }
+    size_t bandwidth() const { return bandwidth_; }
+
+private:
+    std::vector<double> l_;
+    size_t n_ = 0;
+    size_t bandwidth_ = 0;
+
+    double& at(size_t i, size_t j) { return l_[i * (bandwidth_ + 1) + (i - j)]; }
+    double at(size_t i, size_t j) const { return l_[i * (bandwidth_ + 1) + (i - j)]; }
+};
+
+class BSplineCurveFitter {
+public:
+    BSplineCurveFitter(const std::vector<double>& breakpoints, double smoothing);
+
+    void fit(const std::vector<BondData>& bonds);
+
+    void fit(const std::vector<BondData>& bonds, const std::vector<double>& weights);
+
+    void refit_prices(const std::vector<double>& market_prices);
+
+    double get_discount_factor(double time) const;
+
+    double model_price(size_t bond_index) const;
+
+    double rms_price_error() const;
+
+    YieldCurve to_curve(
+        const std::vector<double>& pillars,
+        CompoundingType type,
+        InterpolationType interp_type
+    ) const;
+
+    const std::vector<double>& coefficients() const { return coefficients_; }
+
+    size_t bandwidth() const { return solver_.bandwidth(); }
+
+    bool is_fitted() const { return fitted_; }
+
+private:
+    BSplineBasis basis_;
+    double smoothing_;
+
+    std::vector<double> design_;
+    std::vector<size_t> row_first_;
+    std::vector<size_t> row_last_;
+    std::vector<double> weights_;
+    std::vector<double> prices_;
+    std::vector<double> penalty_rhs_;
+    std::vector<double> coefficients_;
+    BandedCholesky solver_;
+    bool fitted_ = false;
+
+    void build_design(const std::vector<BondData>& bonds);
+
+    void factorize_normal_equations();
+
+    void solve_coefficients();
+};
+
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "date.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace yield_curve {
+
+enum class BusinessDayConvention {
+    UNADJUSTED,
+    FOLLOWING,
+    MODIFIED_FOLLOWING,
+    PRECEDING,
+    MODIFIED_PRECEDING
+};
+
+class HolidayCalendar {
+public:
+    HolidayCalendar(int first_year, int last_year,
+                    const std::vector<Weekday>& weekend = {Weekday::SATURDAY, Weekday::SUNDAY});
+    
+    static HolidayCalendar weekends_only(int first_year, int last_year);
+    
+    static HolidayCalendar target(int first_year, int last_year);
+    
+    void add_holiday(const Date& date);
+    
+    void add_fixed_holiday(unsigned month, unsigned day);
+    
+    bool is_business_day(const Date& date) const;
+    
+    bool is_holiday(const Date& date) const { return !is_business_day(date); }
+    
+    Date next_business_day(const Date& date) const;
+    
+    Date previous_business_day(const Date& date) const;
+    
+    Date adjust(const Date& date, BusinessDayConvention convention) const;
+    
+    Date advance(const Date& date, int business_days) const;
+    
+    int business_days_between(const Date& from, const Date& to) const;
+    
+    int first_year() const { return first_year_; }
+    int last_year() const { return last_year_; }
+    
+private:
+    int first_year_;
+    int last_year_;
+    int32_t first_serial_;
+    int32_t end_serial_;
+    std::vector<uint64_t> business_days_;
+    
+    size_t index(const Date& date) const;
+    
+    Date from_index(size_t index) const { return Date::from_serial(first_serial_ + static_cast<int32_t>(index)); }
+};
+
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "bond_types.hpp"
+#include "hazard_curve.hpp"
+#include "yield_curve.hpp"
+#include <cstddef>
+#include <vector>
+
+namespace yield_curve {
+
+enum class CreditInstrumentType {
+    CDS,
+    RISKY_BOND
+};
+
+struct CreditQuote {
+    CreditInstrumentType type;
+    double maturity;
+    int payment_frequency;
+    double recovery_rate;
+    double spread;
+    double coupon_rate;
+    double market_price;
+    double face_value;
+    
+    static CreditQuote cds(double maturity, double spread, double recovery_rate = 0.4,
+                           int payment_frequency = 4);
+    
+    static CreditQuote risky_bond(const BondData& bond, double recovery_rate = 0.4);
+    
+    std::vector<double> get_payment_times() const;
+};
+
+class CreditBootstrapper {
+public:
+    CreditBootstrapper(const YieldCurve& risk_free_curve,
+                       InterpolationType interp_type = InterpolationType::FLAT_FORWARD);
+    
+    HazardCurve bootstrap(const std::vector<CreditQuote>& quotes) const;
+    
+    std::vector<HazardCurve> bootstrap_all(
+        const std::vector<std::vector<CreditQuote>>& issuers,
+        unsigned num_threads = 0
+    ) const;
+    
+    double instrument_value(const CreditQuote& quote, const HazardCurve& curve) const;
+    
+private:
+    struct Scratch {
+        std::vector<double> payment_times;
+        std::vector<double> discount_factors;
+        std::vector<double> survival;
+        std::vector<double> trial_times;
+        std::vector<double> trial_survival;
+    };
+    
+    struct DiscountCache {
+        std::vector<double> times;
+        std::vector<double> discount_factors;
+    };
+    
+    const YieldCurve& risk_free_curve_;
+    InterpolationType interpolation_type_;
+    
+    static constexpr double SURVIVAL_FLOOR = 1e-10;
+    static constexpr double TOLERANCE = 1e-12;
+    static constexpr int MAX_ITERATIONS = 200;
+    
+    HazardCurve bootstrap_with(
+        const std::vector<CreditQuote>& quotes,
+        const DiscountCache* cache,
+        Scratch& scratch
+    ) const;
+    
+    double solve_survival(
+        const CreditQuote& quote,
+        const HazardCurve& partial_curve,
+        const Interpolator& interpolator,
+        Scratch& scratch
+    ) const;
+    
+    double leg_value(const CreditQuote& quote, const Scratch& scratch) const;
+    
+    double discount(double time, const DiscountCache* cache) const;
+    
+    bool validate_quotes(const std::vector<CreditQuote>& quotes) const;
+};
+
+}
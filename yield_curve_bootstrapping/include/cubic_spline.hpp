@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <vector>
 
 namespace yield_curve {
@@ -16,6 +17,20 @@ public:
     
     bool is_fitted() const { return fitted_; }
     
+    void load(
+        const std::vector<double>& x,
+        const std::vector<double>& a,
+        const std::vector<double>& b,
+        const std::vector<double>& c,
+        const std::vector<double>& d
+    );
+    
+    const std::vector<double>& knots() const { return x_; }
+    const std::vector<double>& coefficients_a() const { return a_; }
+    const std::vector<double>& coefficients_b() const { return b_; }
+    const std::vector<double>& coefficients_c() const { return c_; }
+    const std::vector<double>& coefficients_d() const { return d_; }
+    
 private:
     std::vector<double> x_;
     std::vector<double> y_;
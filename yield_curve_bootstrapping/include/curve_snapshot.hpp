@@ -0,0 +1,90 @@
+#pragma once
+
+#include "bond_types.hpp"
+#include "interpolation.hpp"
+#include "yield_curve.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace yield_curve {
+
+struct CurveRecordView {
+    std::string name;
+    size_t num_points = 0;
+    CompoundingType compounding = CompoundingType::CONTINUOUS;
+    InterpolationType interpolation = InterpolationType::LINEAR;
+    const double* times = nullptr;
+    const double* discount_factors = nullptr;
+    bool has_spline = false;
+    const double* spline_a = nullptr;
+    const double* spline_b = nullptr;
+    const double* spline_c = nullptr;
+    const double* spline_d = nullptr;
+
+    YieldCurve to_curve() const;
+};
+
+class CurveSnapshotWriter {
+public:
+    static constexpr uint32_t FORMAT_VERSION = 1;
+    static constexpr size_t MAX_NAME_LENGTH = 47;
+
+    void add(const std::string& name, const YieldCurve& curve);
+
+    void write(const std::string& path) const;
+
+    size_t size() const { return records_.size(); }
+
+private:
+    struct Record {
+        std::string name;
+        CompoundingType compounding;
+        InterpolationType interpolation;
+        std::vector<double> times;
+        std::vector<double> discount_factors;
+        bool has_spline;
+        std::vector<double> spline_a;
+        std::vector<double> spline_b;
+        std::vector<double> spline_c;
+        std::vector<double> spline_d;
+    };
+
+    std::vector<Record> records_;
+};
+
+class MappedFile;
+
+class CurveStore {
+public:
+    static constexpr const char* FILE_EXTENSION = ".ycs";
+
+    CurveStore();
+    ~CurveStore();
+
+    CurveStore(CurveStore&&) noexcept;
+    CurveStore& operator=(CurveStore&&) noexcept;
+
+    static CurveStore open(const std::string& path);
+
+    bool contains(const std::string& name) const;
+
+    const CurveRecordView& view(const std::string& name) const;
+
+    YieldCurve load(const std::string& name) const;
+
+    std::vector<std::string> names() const;
+
+    size_t size() const { return index_.size(); }
+
+private:
+    std::vector<std::unique_ptr<MappedFile>> files_;
+    std::unordered_map<std::string, CurveRecordView> index_;
+
+    void map_file(const std::string& path);
+};
+
+}
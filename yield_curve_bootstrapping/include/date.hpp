@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace yield_curve {
+
+enum class Weekday {
+    MONDAY,
+    TUESDAY,
+    WEDNESDAY,
+    THURSDAY,
+    FRIDAY,
+    SATURDAY,
+    SUNDAY
+};
+
+class Date {
+public:
+    Date() : serial_(0) {}
+    
+    Date(int year, unsigned month, unsigned day);
+    
+    static Date from_serial(int32_t serial);
+    
+    int year() const;
+    unsigned month() const;
+    unsigned day() const;
+    
+    Weekday weekday() const;
+    
+    int32_t serial() const { return serial_; }
+    
+    Date add_days(int days) const { return from_serial(serial_ + days); }
+    
+    Date add_months(int months, bool end_of_month = false) const;
+    
+    bool is_end_of_month() const;
+    
+    std::string to_string() const;
+    
+    static bool is_leap_year(int year);
+    
+    static unsigned days_in_month(int year, unsigned month);
+    
+    bool operator==(const Date& other) const { return serial_ == other.serial_; }
+    bool operator!=(const Date& other) const { return serial_ != other.serial_; }
+    bool operator<(const Date& other) const { return serial_ < other.serial_; }
+    bool operator<=(const Date& other) const { return serial_ <= other.serial_; }
+    bool operator>(const Date& other) const { return serial_ > other.serial_; }
+    bool operator>=(const Date& other) const { return serial_ >= other.serial_; }
+    
+    int operator-(const Date& other) const { return serial_ - other.serial_; }
+    
+private:
+    int32_t serial_;
+    
+    void to_civil(int& year, unsigned& month, unsigned& day) const;
+};
+
+}
@@ -1,20 +1,235 @@
 #pragma once
 
 #include "bond_types.hpp"
+#include "vector_math.hpp"
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
 
 namespace yield_curve {
 
-class DiscountFactor {
+template <typename Scalar>
+class BasicDiscountFactor {
 public:
-    static double from_zero_rate(double time, double zero_rate, CompoundingType type);
+    static Scalar from_zero_rate(const Scalar& time, const Scalar& zero_rate, CompoundingType type);
     
-    static double to_zero_rate(double time, double discount_factor, CompoundingType type);
+    static Scalar to_zero_rate(const Scalar& time, const Scalar& discount_factor, CompoundingType type);
     
-    static bool is_valid(double discount_factor);
+    static void from_zero_rates(
+        const Scalar* times,
+        const Scalar* zero_rates,
+        Scalar* discount_factors,
+        size_t count,
+        CompoundingType type
+    );
+    
+    static void to_zero_rates(
+        const Scalar* times,
+        const Scalar* discount_factors,
+        Scalar* zero_rates,
+        size_t count,
+        CompoundingType type
+    );
+    
+    static std::vector<Scalar> from_zero_rates(
+        const std::vector<Scalar>& times,
+        const std::vector<Scalar>& zero_rates,
+        CompoundingType type
+    );
+    
+    static std::vector<Scalar> to_zero_rates(
+        const std::vector<Scalar>& times,
+        const std::vector<Scalar>& discount_factors,
+        CompoundingType type
+    );
+    
+    static bool is_valid(const Scalar& discount_factor);
+    
+    static double periods_per_year(CompoundingType type);
     
 private:
     static constexpr double MIN_DF = 1e-10;
     static constexpr double MAX_DF = 1.0;
 };
 
+template <typename Scalar>
+double BasicDiscountFactor<Scalar>::periods_per_year(CompoundingType type) {
+    switch (type) {
+        case CompoundingType::CONTINUOUS:
+            return 0.0;
+        case CompoundingType::ANNUAL:
+            return 1.0;
+        case CompoundingType::SEMI_ANNUAL:
+            return 2.0;
+        case CompoundingType::QUARTERLY:
+            return 4.0;
+        default:
+            throw std::invalid_argument("Unknown compounding type");
+    }
+}
+
+template <typename Scalar>
+Scalar BasicDiscountFactor<Scalar>::from_zero_rate(const Scalar& time, const Scalar& zero_rate, CompoundingType type) {
+    using std::exp;
+    using std::log1p;
+    
+    if (time < 0) {
+        throw std::invalid_argument("Time must be non-negative");
+    }
+    
+    if (time < 1e-10) {
+        return Scalar(1.0);
+    }
+    
+    double m = periods_per_year(type);
+    
+    if (m == 0.0) {
+        return exp(-zero_rate * time);
+    }
+    
+    return exp(-m * time * log1p(zero_rate / m));
+}
+
+template <typename Scalar>
+Scalar BasicDiscountFactor<Scalar>::to_zero_rate(const Scalar& time, const Scalar& discount_factor, CompoundingType type) {
+    using std::expm1;
+    using std::log;
+    
+    if (time < 1e-10) {
+        throw std::invalid_argument("Time too small for rate calculation");
+    }
+    
+    if (discount_factor <= 0 || discount_factor > 1.0) {
+        throw std::invalid_argument("Invalid discount factor");
+    }
+    
+    double m = periods_per_year(type);
+    
+    if (m == 0.0) {
+        return -log(discount_factor) / time;
+    }
+    
+    return m * expm1(-log(discount_factor) / (m * time));
+}
+
+template <typename Scalar>
+void BasicDiscountFactor<Scalar>::from_zero_rates(
+    const Scalar* times,
+    const Scalar* zero_rates,
+    Scalar* discount_factors,
+    size_t count,
+    CompoundingType type
+) {
+    double negative_time = 0.0;
+    for (size_t i = 0; i < count; ++i) {
+        negative_time = times[i] < 0 ? 1.0 : negative_time;
+    }
+    
+    if (negative_time != 0.0) {
+        throw std::invalid_argument("Time must be non-negative");
+    }
+    
+    double m = periods_per_year(type);
+    
+    if (m == 0.0) {
+        for (size_t i = 0; i < count; ++i) {
+            discount_factors[i] = detail::batch_exp(-zero_rates[i] * times[i]);
+        }
+        return;
+    }
+    
+    double inv_m = 1.0 / m;
+    double below_limit = 0.0;
+    for (size_t i = 0; i < count; ++i) {
+        below_limit = zero_rates[i] * inv_m > -1.0 ? below_limit : 1.0;
+    }
+    
+    if (below_limit != 0.0) {
+        throw std::invalid_argument("Zero rate below compounding limit");
+    }
+    
+    for (size_t i = 0; i < count; ++i) {
+        discount_factors[i] = detail::batch_exp(-m * times[i] * detail::batch_log1p(zero_rates[i] * inv_m));
+    }
+}
+
+template <typename Scalar>
+void BasicDiscountFactor<Scalar>::to_zero_rates(
+    const Scalar* times,
+    const Scalar* discount_factors,
+    Scalar* zero_rates,
+    size_t count,
+    CompoundingType type
+) {
+    double small_time = 0.0;
+    double invalid_df = 0.0;
+    for (size_t i = 0; i < count; ++i) {
+        small_time = times[i] < 1e-10 ? 1.0 : small_time;
+        invalid_df = discount_factors[i] > 0 ? invalid_df : 1.0;
+        invalid_df = discount_factors[i] > 1.0 ? 1.0 : invalid_df;
+    }
+    
+    if (small_time != 0.0) {
+        throw std::invalid_argument("Time too small for rate calculation");
+    }
+    
+    if (invalid_df != 0.0) {
+        throw std::invalid_argument("Invalid discount factor");
+    }
+    
+    double m = periods_per_year(type);
+    
+    if (m == 0.0) {
+        for (size_t i = 0; i < count; ++i) {
+            zero_rates[i] = -detail::batch_log(discount_factors[i]) / times[i];
+        }
+        return;
+    }
+    
+    double inv_m = 1.0 / m;
+    for (size_t i = 0; i < count; ++i) {
+        zero_rates[i] = m * detail::batch_expm1(-detail::batch_log(discount_factors[i]) * inv_m / times[i]);
+    }
+}
+
+template <typename Scalar>
+std::vector<Scalar> BasicDiscountFactor<Scalar>::from_zero_rates(
+    const std::vector<Scalar>& times,
+    const std::vector<Scalar>& zero_rates,
+    CompoundingType type
+) {
+    if (times.size() != zero_rates.size()) {
+        throw std::invalid_argument("Times and zero rates size mismatch");
+    }
+    
+    std::vector<Scalar> discount_factors(times.size());
+    from_zero_rates(times.data(), zero_rates.data(), discount_factors.data(), times.size(), type);
+    return discount_factors;
+}
+
+template <typename Scalar>
+std::vector<Scalar> BasicDiscountFactor<Scalar>::to_zero_rates(
+    const std::vector<Scalar>& times,
+    const std::vector<Scalar>& discount_factors,
+    CompoundingType type
+) {
+    if (times.size() != discount_factors.size()) {
+        throw std::invalid_argument("Times and discount factors size mismatch");
+    }
+    
+    std::vector<Scalar> zero_rates(times.size());
+    to_zero_rates(times.data(), discount_factors.data(), zero_rates.data(), times.size(), type);
+    return zero_rates;
+}
+
+template <typename Scalar>
+bool BasicDiscountFactor<Scalar>::is_valid(const Scalar& discount_factor) {
+    return discount_factor > MIN_DF && discount_factor <= MAX_DF;
+}
+
+extern template class BasicDiscountFactor<double>;
+
+using DiscountFactor = BasicDiscountFactor<double>;
+
 }
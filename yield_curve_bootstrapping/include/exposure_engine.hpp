@@ -0,0 +1,70 @@
+#pragma once
+
+#include "bond_types.hpp"
+#include "yield_curve.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace yield_curve {
+
+struct ExposureProfile {
+    std::vector<double> times;
+    std::vector<double> expected_value;
+    std::vector<double> expected_exposure;
+    std::vector<double> potential_future_exposure;
+};
+
+class ExposureEngine {
+public:
+    static constexpr size_t BLOCK_PATHS = 1024;
+    
+    ExposureEngine(const YieldCurve& curve, double mean_reversion, double volatility);
+    
+    void add_cash_flows(const std::vector<double>& times, const std::vector<double>& amounts);
+    
+    void add_bond(const BondData& bond, double quantity = 1.0);
+    
+    void add_swap(const SwapData& swap);
+    
+    ExposureProfile simulate(
+        const std::vector<double>& exposure_times,
+        size_t num_paths,
+        double pfe_quantile = 0.95,
+        uint64_t seed = 42,
+        unsigned num_threads = 0
+    ) const;
+    
+    size_t num_flows() const { return flows_.size(); }
+    
+private:
+    struct Flow {
+        size_t time_index;
+        double amount;
+        double live_from;
+        double live_until;
+    };
+    
+    struct Reset {
+        double reset_time;
+        double pay_time;
+        double notional;
+        double accrual;
+        double spread;
+    };
+    
+    const YieldCurve& curve_;
+    double a_;
+    double sigma_;
+    std::vector<double> flow_times_;
+    std::vector<Flow> flows_;
+    std::vector<Reset> resets_;
+    
+    size_t intern_time(double time);
+    
+    void add_flow(double pay_time, double amount, double live_from, double live_until);
+    
+    double b_factor(double tau) const;
+};
+
+}
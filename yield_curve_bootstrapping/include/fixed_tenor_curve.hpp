@@ -0,0 +1,168 @@
+#pragma once
+
+#include "discount_factor.hpp"
+#include "interpolation.hpp"
+#include "yield_curve.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace yield_curve {
+
+template <size_t N>
+struct TenorGrid;
+
+template <>
+struct TenorGrid<20> {
+    static constexpr std::array<double, 20> times = {
+        0.0, 1.0 / 12.0, 2.0 / 12.0, 0.25, 0.5, 0.75, 1.0, 2.0, 3.0, 4.0,
+        5.0, 6.0, 7.0, 8.0, 10.0, 12.0, 15.0, 20.0, 25.0, 30.0
+    };
+};
+
+template <size_t N, InterpolationType Interp = InterpolationType::FLAT_FORWARD,
+          typename Grid = TenorGrid<N>>
+class FixedTenorCurve {
+public:
+    static_assert(N >= 2, "Fixed tenor curve needs at least two pillars");
+    static_assert(Grid::times.size() == N, "Tenor grid size must match N");
+    
+    static constexpr const std::array<double, N>& tenors() { return Grid::times; }
+    
+    static constexpr size_t size() { return N; }
+    
+    FixedTenorCurve() {
+        for (size_t i = 0; i < N; ++i) {
+            values_[i] = (Interp == InterpolationType::LINEAR) ? 1.0 : 0.0;
+        }
+    }
+    
+    explicit FixedTenorCurve(const std::array<double, N>& discount_factors) {
+        for (size_t i = 0; i < N; ++i) {
+            if (!DiscountFactor::is_valid(discount_factors[i])) {
+                throw std::invalid_argument("Invalid discount factor");
+            }
+            values_[i] = (Interp == InterpolationType::LINEAR)
+                ? discount_factors[i] : std::log(discount_factors[i]);
+        }
+    }
+    
+    static FixedTenorCurve from_curve(const YieldCurve& curve) {
+        std::array<double, N> dfs;
+        for (size_t i = 0; i < N; ++i) {
+            dfs[i] = curve.get_discount_factor(Grid::times[i]);
+        }
+        return FixedTenorCurve(dfs);
+    }
+    
+    double get_discount_factor(double t) const {
+        if (t < 1e-10) {
+            return 1.0;
+        }
+        
+        size_t i = interval(t);
+        double t1 = Grid::times[i];
+        double t2 = Grid::times[i + 1];
+        double tc = (Interp == InterpolationType::FLAT_FORWARD)
+            ? std::max(t, Grid::times[0])
+            : std::min(std::max(t, Grid::times[0]), Grid::times[N - 1]);
+        double weight = (tc - t1) / (t2 - t1);
+        double value = values_[i] + weight * (values_[i + 1] - values_[i]);
+        
+        return (Interp == InterpolationType::LINEAR) ? value : std::exp(value);
+    }
+    
+    void get_discount_factors(const double* times, double* out, size_t count) const {
+        for (size_t k = 0; k < count; ++k) {
+            out[k] = get_discount_factor(times[k]);
+        }
+    }
+    
+    double get_zero_rate(double t, CompoundingType type = CompoundingType::CONTINUOUS) const {
+        return DiscountFactor::to_zero_rate(t, get_discount_factor(t), type);
+    }
+    
+    double get_forward_rate(double t1, double t2) const {
+        if (t1 >= t2) {
+            throw std::invalid_argument("t1 must be less than t2");
+        }
+        return -std::log(get_discount_factor(t2) / get_discount_factor(t1)) / (t2 - t1);
+    }
+    
+    double get_instantaneous_forward(double t) const {
+        bool outside = t < Grid::times[0] ||
+            (Interp != InterpolationType::FLAT_FORWARD && t >= Grid::times[N - 1]);
+        if (outside) {
+            return 0.0;
+        }
+        
+        size_t i = interval(t);
+        double dt = Grid::times[i + 1] - Grid::times[i];
+        double slope = (values_[i + 1] - values_[i]) / dt;
+        
+        if (Interp == InterpolationType::LINEAR) {
+            return -slope / (values_[i] + slope * (t - Grid::times[i]));
+        }
+        return -slope;
+    }
+    
+    double discount_factor_at(size_t pillar) const {
+        return (Interp == InterpolationType::LINEAR) ? values_[pillar] : std::exp(values_[pillar]);
+    }
+    
+    std::array<double, N> discount_factors() const {
+        std::array<double, N> dfs;
+        for (size_t i = 0; i < N; ++i) {
+            dfs[i] = discount_factor_at(i);
+        }
+        return dfs;
+    }
+    
+    FixedTenorCurve shifted(double zero_rate_shift) const {
+        std::array<double, N> dfs = discount_factors();
+        for (size_t i = 0; i < N; ++i) {
+            dfs[i] *= std::exp(-zero_rate_shift * Grid::times[i]);
+        }
+        return FixedTenorCurve(dfs);
+    }
+    
+    FixedTenorCurve bumped(size_t pillar, double zero_rate_shift) const {
+        if (pillar >= N) {
+            throw std::out_of_range("Pillar index out of range");
+        }
+        std::array<double, N> dfs = discount_factors();
+        dfs[pillar] *= std::exp(-zero_rate_shift * Grid::times[pillar]);
+        return FixedTenorCurve(dfs);
+    }
+    
+    YieldCurve to_curve(CompoundingType type = CompoundingType::CONTINUOUS) const {
+        YieldCurve curve(type, Interp);
+        for (size_t i = 0; i < N; ++i) {
+            curve.add_point(Grid::times[i], discount_factor_at(i));
+        }
+        return curve;
+    }
+    
+private:
+    std::array<double, N> values_;
+    
+    template <size_t... I>
+    static size_t interval(double t, std::index_sequence<I...>) {
+        return (size_t(0) + ... + static_cast<size_t>(t >= Grid::times[I + 1]));
+    }
+    
+    static size_t interval(double t) {
+        return interval(t, std::make_index_sequence<N - 2>());
+    }
+};
+
+using StandardTenorCurve = FixedTenorCurve<20>;
+
+static_assert(std::is_trivially_copyable<StandardTenorCurve>::value,
+              "Fixed tenor curves must be trivially copyable");
+
+}
@@ -17,6 +17,10 @@ public:
         const std::vector<double>& tenors
     ) const;
     
+    std::vector<double> get_instantaneous_forward_curve(
+        const std::vector<double>& tenors
+    ) const;
+    
 private:
     const YieldCurve& yield_curve_;
 };
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "interpolation.hpp"
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace yield_curve {
+
+class HazardCurve {
+public:
+    HazardCurve();
+    
+    explicit HazardCurve(InterpolationType interp_type);
+    
+    void add_point(double time, double survival_probability);
+    
+    double get_survival_probability(double time) const;
+    
+    double get_default_probability(double t1, double t2) const;
+    
+    double get_hazard_rate(double time) const;
+    
+    const std::vector<double>& times() const { return times_; }
+    const std::vector<double>& survival_probabilities() const { return survival_; }
+    
+    size_t size() const { return times_.size() - 1; }
+    
+    InterpolationType interpolation_type() const { return interpolation_type_; }
+    
+private:
+    std::vector<double> times_;
+    std::vector<double> survival_;
+    InterpolationType interpolation_type_;
+    std::unique_ptr<Interpolator> interpolator_;
+};
+
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "yield_curve.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace yield_curve {
+
+class PathAccumulator {
+public:
+    virtual ~PathAccumulator() = default;
+
+    virtual std::unique_ptr<PathAccumulator> clone() const = 0;
+
+    virtual void observe(
+        size_t step,
+        double time,
+        const double* short_rates,
+        const double* discount_factors,
+        size_t num_paths
+    ) = 0;
+
+    virtual void merge(const PathAccumulator& other) = 0;
+};
+
+class DiscountFactorAccumulator : public PathAccumulator {
+public:
+    explicit DiscountFactorAccumulator(size_t num_steps);
+
+    std::unique_ptr<PathAccumulator> clone() const override;
+
+    void observe(
+        size_t step,
+        double time,
+        const double* short_rates,
+        const double* discount_factors,
+        size_t num_paths
+    ) override;
+
+    void merge(const PathAccumulator& other) override;
+
+    double mean(size_t step) const;
+
+    double standard_error(size_t step) const;
+
+    size_t num_paths() const { return count_; }
+
+private:
+    std::vector<double> sum_;
+    std::vector<double> sum_sq_;
+    size_t count_ = 0;
+};
+
+class HullWhiteSimulator {
+public:
+    HullWhiteSimulator(
+        const YieldCurve& curve,
+        double mean_reversion,
+        double volatility,
+        double horizon,
+        size_t num_steps
+    );
+
+    double theta(double t) const;
+
+    void simulate(
+        size_t num_paths,
+        PathAccumulator& accumulator,
+        uint64_t seed = 42,
+        unsigned num_threads = 0
+    ) const;
+
+    const std::vector<double>& time_grid() const { return times_; }
+
+    size_t num_steps() const { return times_.size() - 1; }
+
+    double mean_reversion() const { return a_; }
+    double volatility() const { return sigma_; }
+
+    static constexpr size_t BLOCK_PATHS = 1024;
+
+private:
+    struct Workspace {
+        std::vector<double> x;
+        std::vector<double> integral;
+        std::vector<double> rates;
+        std::vector<double> discount_factors;
+        std::vector<double> normals;
+    };
+
+    const YieldCurve& curve_;
+    double a_;
+    double sigma_;
+    std::vector<double> times_;
+    std::vector<double> alpha_;
+    std::vector<double> decay_;
+    std::vector<double> shock_std_;
+
+    void calibrate_drift();
+
+    void simulate_block(
+        size_t block,
+        size_t paths,
+        uint64_t seed,
+        PathAccumulator& accumulator,
+        Workspace& workspace
+    ) const;
+};
+
+}
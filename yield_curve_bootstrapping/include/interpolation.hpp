@@ -1,7 +1,11 @@
 #pragma once
 
-#include <vector>
+#include <algorithm>
+#include <cmath>
 #include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 namespace yield_curve {
 
@@ -11,55 +15,335 @@ enum class InterpolationType {
     FLAT_FORWARD
 };
 
-class Interpolator {
+template <typename Scalar>
+class BasicInterpolator {
 public:
-    virtual ~Interpolator() = default;
+    virtual ~BasicInterpolator() = default;
+    
+    virtual Scalar interpolate(
+        double t,
+        const std::vector<double>& times,
+        const std::vector<Scalar>& discount_factors
+    ) const = 0;
     
-    virtual double interpolate(
+    virtual Scalar instantaneous_forward(
         double t,
         const std::vector<double>& times,
-        const std::vector<double>& discount_factors
+        const std::vector<Scalar>& discount_factors
     ) const = 0;
     
     virtual std::string name() const = 0;
     
 protected:
     size_t find_interval(double t, const std::vector<double>& times) const;
+    
+    size_t find_forward_interval(double t, const std::vector<double>& times) const;
 };
 
-class LinearInterpolator : public Interpolator {
+template <typename Scalar>
+class BasicLinearInterpolator : public BasicInterpolator<Scalar> {
 public:
-    double interpolate(
+    Scalar interpolate(
+        double t,
+        const std::vector<double>& times,
+        const std::vector<Scalar>& discount_factors
+    ) const override;
+    
+    Scalar instantaneous_forward(
         double t,
         const std::vector<double>& times,
-        const std::vector<double>& discount_factors
+        const std::vector<Scalar>& discount_factors
     ) const override;
     
     std::string name() const override { return "Linear"; }
 };
 
-class LogLinearInterpolator : public Interpolator {
+template <typename Scalar>
+class BasicLogLinearInterpolator : public BasicInterpolator<Scalar> {
 public:
-    double interpolate(
+    Scalar interpolate(
         double t,
         const std::vector<double>& times,
-        const std::vector<double>& discount_factors
+        const std::vector<Scalar>& discount_factors
+    ) const override;
+    
+    Scalar instantaneous_forward(
+        double t,
+        const std::vector<double>& times,
+        const std::vector<Scalar>& discount_factors
     ) const override;
     
     std::string name() const override { return "Log-Linear"; }
 };
 
-class FlatForwardInterpolator : public Interpolator {
+template <typename Scalar>
+class BasicFlatForwardInterpolator : public BasicInterpolator<Scalar> {
 public:
-    double interpolate(
+    Scalar interpolate(
+        double t,
+        const std::vector<double>& times,
+        const std::vector<Scalar>& discount_factors
+    ) const override;
+    
+    Scalar instantaneous_forward(
         double t,
         const std::vector<double>& times,
-        const std::vector<double>& discount_factors
+        const std::vector<Scalar>& discount_factors
     ) const override;
     
     std::string name() const override { return "Flat-Forward"; }
 };
 
-std::unique_ptr<Interpolator> create_interpolator(InterpolationType type);
+template <typename Scalar = double>
+std::unique_ptr<BasicInterpolator<Scalar>> create_interpolator(InterpolationType type);
+
+template <typename Scalar>
+size_t BasicInterpolator<Scalar>::find_interval(double t, const std::vector<double>& times) const {
+    if (times.empty()) {
+        throw std::runtime_error("Empty times vector");
+    }
+    
+    if (t <= times.front()) {
+        return 0;
+    }
+    
+    if (t >= times.back()) {
+        return times.size() - 2;
+    }
+    
+    auto it = std::lower_bound(times.begin(), times.end(), t);
+    size_t idx = std::distance(times.begin(), it);
+    
+    if (idx > 0) {
+        --idx;
+    }
+    
+    return idx;
+}
+
+template <typename Scalar>
+size_t BasicInterpolator<Scalar>::find_forward_interval(double t, const std::vector<double>& times) const {
+    auto it = std::upper_bound(times.begin(), times.end(), t);
+    size_t idx = std::distance(times.begin(), it);
+    
+    if (idx > 0) {
+        --idx;
+    }
+    
+    return std::min(idx, times.size() - 2);
+}
+
+template <typename Scalar>
+Scalar BasicLinearInterpolator<Scalar>::interpolate(
+    double t,
+    const std::vector<double>& times,
+    const std::vector<Scalar>& discount_factors
+) const {
+    if (times.size() != discount_factors.size()) {
+        throw std::invalid_argument("Times and discount factors size mismatch");
+    }
+    
+    if (times.size() == 1) {
+        return discount_factors[0];
+    }
+    
+    if (t <= times.front()) {
+        return discount_factors.front();
+    }
+    
+    if (t >= times.back()) {
+        return discount_factors.back();
+    }
+    
+    size_t i = this->find_interval(t, times);
+    
+    double t1 = times[i];
+    double t2 = times[i + 1];
+    Scalar df1 = discount_factors[i];
+    Scalar df2 = discount_factors[i + 1];
+    
+    double weight = (t - t1) / (t2 - t1);
+    return df1 + weight * (df2 - df1);
+}
+
+template <typename Scalar>
+Scalar BasicLinearInterpolator<Scalar>::instantaneous_forward(
+    double t,
+    const std::vector<double>& times,
+    const std::vector<Scalar>& discount_factors
+) const {
+    if (times.size() != discount_factors.size()) {
+        throw std::invalid_argument("Times and discount factors size mismatch");
+    }
+    
+    if (times.size() == 1 || t < times.front() || t >= times.back()) {
+        return Scalar(0.0);
+    }
+    
+    size_t i = this->find_forward_interval(t, times);
+    
+    double t1 = times[i];
+    double t2 = times[i + 1];
+    Scalar df1 = discount_factors[i];
+    Scalar df2 = discount_factors[i + 1];
+    
+    Scalar slope = (df2 - df1) / (t2 - t1);
+    Scalar df = df1 + slope * (t - t1);
+    
+    return -slope / df;
+}
+
+template <typename Scalar>
+Scalar BasicLogLinearInterpolator<Scalar>::interpolate(
+    double t,
+    const std::vector<double>& times,
+    const std::vector<Scalar>& discount_factors
+) const {
+    using std::exp;
+    using std::log;
+    
+    if (times.size() != discount_factors.size()) {
+        throw std::invalid_argument("Times and discount factors size mismatch");
+    }
+    
+    if (times.size() == 1) {
+        return discount_factors[0];
+    }
+    
+    if (t <= times.front()) {
+        return discount_factors.front();
+    }
+    
+    if (t >= times.back()) {
+        return discount_factors.back();
+    }
+    
+    size_t i = this->find_interval(t, times);
+    
+    double t1 = times[i];
+    double t2 = times[i + 1];
+    Scalar df1 = discount_factors[i];
+    Scalar df2 = discount_factors[i + 1];
+    
+    Scalar log_df1 = log(df1);
+    Scalar log_df2 = log(df2);
+    
+    double weight = (t - t1) / (t2 - t1);
+    Scalar log_df = log_df1 + weight * (log_df2 - log_df1);
+    
+    return exp(log_df);
+}
+
+template <typename Scalar>
+Scalar BasicLogLinearInterpolator<Scalar>::instantaneous_forward(
+    double t,
+    const std::vector<double>& times,
+    const std::vector<Scalar>& discount_factors
+) const {
+    using std::log;
+    
+    if (times.size() != discount_factors.size()) {
+        throw std::invalid_argument("Times and discount factors size mismatch");
+    }
+    
+    if (times.size() == 1 || t < times.front() || t >= times.back()) {
+        return Scalar(0.0);
+    }
+    
+    size_t i = this->find_forward_interval(t, times);
+    
+    return -log(discount_factors[i + 1] / discount_factors[i]) / (times[i + 1] - times[i]);
+}
+
+template <typename Scalar>
+Scalar BasicFlatForwardInterpolator<Scalar>::interpolate(
+    double t,
+    const std::vector<double>& times,
+    const std::vector<Scalar>& discount_factors
+) const {
+    using std::exp;
+    using std::log;
+    
+    if (times.size() != discount_factors.size()) {
+        throw std::invalid_argument("Times and discount factors size mismatch");
+    }
+    
+    if (times.size() == 1) {
+        return discount_factors[0];
+    }
+    
+    if (t <= times.front()) {
+        return discount_factors.front();
+    }
+    
+    if (t >= times.back()) {
+        size_t n = times.size();
+        double t1 = times[n - 2];
+        double t2 = times[n - 1];
+        Scalar df1 = discount_factors[n - 2];
+        Scalar df2 = discount_factors[n - 1];
+        
+        Scalar forward_rate = -log(df2 / df1) / (t2 - t1);
+        return df2 * exp(-forward_rate * (t - t2));
+    }
+    
+    size_t i = this->find_interval(t, times);
+    
+    double t1 = times[i];
+    double t2 = times[i + 1];
+    Scalar df1 = discount_factors[i];
+    Scalar df2 = discount_factors[i + 1];
+    
+    Scalar forward_rate = -log(df2 / df1) / (t2 - t1);
+    
+    return df1 * exp(-forward_rate * (t - t1));
+}
+
+template <typename Scalar>
+Scalar BasicFlatForwardInterpolator<Scalar>::instantaneous_forward(
+    double t,
+    const std::vector<double>& times,
+    const std::vector<Scalar>& discount_factors
+) const {
+    using std::log;
+    
+    if (times.size() != discount_factors.size()) {
+        throw std::invalid_argument("Times and discount factors size mismatch");
+    }
+    
+    if (times.size() == 1 || t < times.front()) {
+        return Scalar(0.0);
+    }
+    
+    size_t i = this->find_forward_interval(t, times);
+    
+    return -log(discount_factors[i + 1] / discount_factors[i]) / (times[i + 1] - times[i]);
+}
+
+template <typename Scalar>
+std::unique_ptr<BasicInterpolator<Scalar>> create_interpolator(InterpolationType type) {
+    switch (type) {
+        case InterpolationType::LINEAR:
+            return std::make_unique<BasicLinearInterpolator<Scalar>>();
+        case InterpolationType::LOG_LINEAR:
+            return std::make_unique<BasicLogLinearInterpolator<Scalar>>();
+        case InterpolationType::FLAT_FORWARD:
+            return std::make_unique<BasicFlatForwardInterpolator<Scalar>>();
+        default:
+            throw std::invalid_argument("Unknown interpolation type");
+    }
+}
+
+extern template class BasicInterpolator<double>;
+extern template class BasicLinearInterpolator<double>;
+extern template class BasicLogLinearInterpolator<double>;
+extern template class BasicFlatForwardInterpolator<double>;
+
+extern template std::unique_ptr<BasicInterpolator<double>> create_interpolator<double>(InterpolationType type);
+
+using Interpolator = BasicInterpolator<double>;
+using LinearInterpolator = BasicLinearInterpolator<double>;
+using LogLinearInterpolator = BasicLogLinearInterpolator<double>;
+using FlatForwardInterpolator = BasicFlatForwardInterpolator<double>;
 
 }
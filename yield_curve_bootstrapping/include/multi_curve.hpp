@@ -0,0 +1,140 @@
+#pragma once
+
+#include "bond_types.hpp"
+#include "yield_curve.hpp"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace yield_curve {
+
+enum class RateInstrumentType {
+    DEPOSIT,
+    FRA,
+    FUTURE,
+    SWAP
+};
+
+struct RateInstrument {
+    RateInstrumentType type;
+    size_t discount_curve;
+    size_t projection_curve;
+    double start;
+    double end;
+    double quote;
+    int fixed_frequency;
+    int float_frequency;
+    double convexity_adjustment;
+    
+    static RateInstrument deposit(size_t curve, double maturity, double rate);
+    
+    static RateInstrument fra(size_t curve, double start, double end, double rate);
+    
+    static RateInstrument future(size_t curve, double start, double end, double price,
+                                 double convexity_adjustment = 0.0);
+    
+    static RateInstrument swap(size_t discount_curve, size_t projection_curve, double maturity,
+                               double rate, int fixed_frequency = 1, int float_frequency = 4);
+    
+    static RateInstrument ois_swap(size_t curve, double maturity, double rate, int frequency = 1);
+    
+    double implied_rate() const;
+};
+
+class MultiCurveBuilder {
+public:
+    explicit MultiCurveBuilder(CompoundingType type = CompoundingType::CONTINUOUS);
+    
+    size_t add_curve(const std::string& name);
+    
+    void add_instrument(const RateInstrument& instrument);
+    
+    void build();
+    
+    void update_quotes(const std::vector<double>& quotes);
+    
+    YieldCurve curve(size_t index) const;
+    
+    YieldCurve curve(const std::string& name) const;
+    
+    double get_discount_factor(size_t curve, double time) const;
+    
+    double instrument_value(size_t instrument) const;
+    
+    const std::vector<double>& pillars(size_t curve) const;
+    
+    size_t num_curves() const { return curves_.size(); }
+    size_t num_instruments() const { return instruments_.size(); }
+    
+    const std::vector<RateInstrument>& instruments() const { return instruments_; }
+    
+    int iterations() const { return iterations_; }
+    
+private:
+    struct CurveLayout {
+        std::string name;
+        size_t offset;
+        std::vector<double> pillars;
+    };
+    
+    struct Node {
+        int lo;
+        int hi;
+        double w_lo;
+        double w_hi;
+    };
+    
+    struct Term {
+        size_t first_node;
+        size_t num_nodes;
+        double base;
+        double slope;
+    };
+    
+    struct Kernel {
+        size_t first_term;
+        size_t num_terms;
+        double base;
+        double slope;
+    };
+    
+    static constexpr double TOLERANCE = 1e-12;
+    static constexpr double INITIAL_RATE = 0.02;
+    static constexpr int MAX_ITERATIONS = 50;
+    
+    CompoundingType compounding_type_;
+    std::vector<CurveLayout> curves_;
+    std::vector<RateInstrument> instruments_;
+    std::vector<Node> nodes_;
+    std::vector<double> node_signs_;
+    std::vector<Term> terms_;
+    std::vector<Kernel> kernels_;
+    std::vector<double> state_;
+    std::vector<double> residuals_;
+    std::vector<double> jacobian_;
+    int iterations_ = 0;
+    bool compiled_ = false;
+    bool solved_ = false;
+    
+    void compile();
+    
+    Node make_node(size_t curve, double time) const;
+    
+    void begin_term(double base, double slope);
+    
+    void add_node(size_t curve, double time, double sign);
+    
+    void compile_instrument(const RateInstrument& instrument);
+    
+    double node_log_df(const Node& node) const;
+    
+    double evaluate_kernel(size_t index, double* jacobian_row) const;
+    
+    void solve();
+    
+    void solve_linear_system(std::vector<double>& rhs);
+    
+    void validate_instrument(const RateInstrument& instrument) const;
+};
+
+}
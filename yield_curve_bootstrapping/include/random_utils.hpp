@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+
+namespace yield_curve {
+namespace detail {
+
+inline uint64_t splitmix64(uint64_t x) {
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+inline void fill_normals(std::mt19937_64& rng, double* out, size_t count) {
+    constexpr double TWO_PI = 6.283185307179586;
+    constexpr double INV_2_53 = 1.0 / 9007199254740992.0;
+
+    for (size_t i = 0; i < count; i += 2) {
+        double u1 = ((rng() >> 11) + 1.0) * INV_2_53;
+        double u2 = (rng() >> 11) * INV_2_53;
+        double radius = std::sqrt(-2.0 * std::log(u1));
+        out[i] = radius * std::cos(TWO_PI * u2);
+        if (i + 1 < count) {
+            out[i + 1] = radius * std::sin(TWO_PI * u2);
+        }
+    }
+}
+
+}
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "bond_types.hpp"
+#include "yield_curve.hpp"
+#include <cstddef>
+#include <vector>
+
+namespace yield_curve {
+
+class ScenarioSet {
+public:
+    explicit ScenarioSet(const YieldCurve& base_curve);
+
+    size_t add_parallel_shift(double shift);
+
+    size_t add_twist(double short_shift, double long_shift);
+
+    size_t add_key_rate_bump(size_t pillar, double shift);
+
+    size_t add_zero_rate_shifts(const std::vector<double>& shifts);
+
+    void add_pca_scenarios(
+        const std::vector<std::vector<double>>& loadings,
+        const std::vector<std::vector<double>>& scores
+    );
+
+    void discount_factors(double time, std::vector<double>& out) const;
+
+    double get_discount_factor(size_t scenario, double time) const;
+
+    std::vector<double> price_cash_flows(
+        const std::vector<double>& times,
+        const std::vector<double>& amounts,
+        unsigned num_threads = 0
+    ) const;
+
+    std::vector<double> price_portfolio(
+        const std::vector<BondData>& bonds,
+        const std::vector<double>& notionals,
+        unsigned num_threads = 0
+    ) const;
+
+    size_t num_scenarios() const { return num_scenarios_; }
+    size_t num_pillars() const { return times_.size(); }
+
+    const std::vector<double>& times() const { return times_; }
+
+private:
+    struct Lookup {
+        size_t lo;
+        size_t hi;
+        double weight;
+        bool at_origin;
+    };
+
+    std::vector<double> times_;
+    std::vector<double> base_log_dfs_;
+    std::vector<double> log_dfs_;
+    size_t num_scenarios_ = 0;
+    size_t capacity_ = 0;
+
+    const double* pillar_row(size_t pillar) const { return log_dfs_.data() + pillar * capacity_; }
+
+    void reserve_scenarios(size_t count);
+
+    Lookup locate(double time) const;
+
+    double evaluate(const Lookup& lookup, size_t scenario) const;
+
+    void evaluate_range(const Lookup& lookup, size_t begin, size_t end, double* out) const;
+};
+
+}
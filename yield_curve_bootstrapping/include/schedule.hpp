@@ -0,0 +1,70 @@
+#pragma once
+
+#include "calendar.hpp"
+#include "date.hpp"
+#include <vector>
+
+namespace yield_curve {
+
+enum class DayCountConvention {
+    ACT_360,
+    ACT_365_FIXED,
+    THIRTY_360,
+    ACT_ACT_ISDA
+};
+
+class DayCounter {
+public:
+    static double year_fraction(const Date& start, const Date& end, DayCountConvention convention);
+};
+
+struct CouponSchedule {
+    std::vector<Date> dates;
+    std::vector<double> accruals;
+    
+    size_t size() const { return accruals.size(); }
+};
+
+struct DatedBond {
+    Date effective;
+    Date maturity;
+    double coupon_rate;
+    int payment_frequency;
+    double market_price;
+    double face_value;
+    
+    DatedBond(const Date& eff, const Date& mat, double coupon, int freq, double price,
+              double fv = 100.0)
+        : effective(eff), maturity(mat), coupon_rate(coupon), payment_frequency(freq),
+          market_price(price), face_value(fv) {}
+};
+
+class ScheduleGenerator {
+public:
+    ScheduleGenerator(
+        const HolidayCalendar& calendar,
+        BusinessDayConvention convention = BusinessDayConvention::MODIFIED_FOLLOWING,
+        DayCountConvention day_count = DayCountConvention::THIRTY_360,
+        bool end_of_month = true
+    );
+    
+    CouponSchedule generate(const Date& effective, const Date& maturity, int frequency) const;
+    
+    void generate(const Date& effective, const Date& maturity, int frequency,
+                  CouponSchedule& schedule) const;
+    
+    void cash_flows(
+        const DatedBond& bond,
+        const Date& valuation_date,
+        std::vector<double>& payment_times,
+        std::vector<double>& cash_flows
+    ) const;
+    
+private:
+    const HolidayCalendar& calendar_;
+    BusinessDayConvention convention_;
+    DayCountConvention day_count_;
+    bool end_of_month_;
+};
+
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "bond_types.hpp"
+#include "yield_curve.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <tuple>
+#include <vector>
+
+namespace yield_curve {
+
+class SwapPortfolio {
+public:
+    size_t add(const SwapData& swap);
+    
+    std::vector<double> value(const YieldCurve& curve, unsigned num_threads = 0) const;
+    
+    std::vector<double> value(
+        const YieldCurve& discount_curve,
+        const YieldCurve& projection_curve,
+        unsigned num_threads = 0
+    ) const;
+    
+    std::vector<double> par_rates(
+        const YieldCurve& discount_curve,
+        const YieldCurve& projection_curve,
+        unsigned num_threads = 0
+    ) const;
+    
+    size_t size() const { return trades_.size(); }
+    
+    size_t num_schedules() const { return schedules_.size(); }
+    
+private:
+    using ScheduleKey = std::tuple<int64_t, int64_t, int>;
+    
+    struct Schedule {
+        std::vector<double> times;
+        std::vector<double> accruals;
+    };
+    
+    struct Trade {
+        size_t fixed_schedule;
+        size_t float_schedule;
+        double signed_notional;
+        double fixed_rate;
+        double float_spread;
+    };
+    
+    struct LegValues {
+        std::vector<double> annuities;
+        std::vector<double> float_values;
+    };
+    
+    std::vector<Schedule> schedules_;
+    std::map<ScheduleKey, size_t> schedule_index_;
+    std::vector<Trade> trades_;
+    
+    size_t intern_schedule(double start, double maturity, const std::vector<double>& times, int frequency);
+    
+    LegValues evaluate_legs(const YieldCurve& discount_curve, const YieldCurve& projection_curve) const;
+    
+    template <typename Kernel>
+    std::vector<double> for_each_trade(unsigned num_threads, Kernel kernel) const;
+};
+
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "bond_types.hpp"
+#include "yield_curve.hpp"
+#include <cstddef>
+#include <vector>
+
+namespace yield_curve {
+
+class HullWhiteLattice {
+public:
+    HullWhiteLattice(
+        const YieldCurve& curve,
+        double mean_reversion,
+        double volatility,
+        double horizon,
+        size_t num_steps
+    );
+
+    double price(const CallableBond& bond) const;
+
+    std::vector<double> price_batch(
+        const std::vector<CallableBond>& bonds,
+        unsigned num_threads = 0
+    ) const;
+
+    double dt() const { return dt_; }
+    double dx() const { return dx_; }
+    int j_max() const { return j_max_; }
+    size_t num_steps() const { return alpha_.size(); }
+
+private:
+    struct Branch {
+        int middle;
+        double p_up;
+        double p_mid;
+        double p_down;
+    };
+
+    double a_;
+    double sigma_;
+    double dt_;
+    double dx_;
+    int j_max_;
+    std::vector<Branch> branches_;
+    std::vector<double> alpha_;
+    std::vector<double> step_discount_;
+    std::vector<double> node_discount_;
+
+    size_t width() const { return 2 * static_cast<size_t>(j_max_) + 1; }
+
+    int level_extent(size_t step) const;
+
+    size_t to_step(double time) const;
+
+    void build_branches();
+
+    void calibrate(const YieldCurve& curve);
+
+    double price_with_buffers(
+        const CallableBond& bond,
+        std::vector<double>& current,
+        std::vector<double>& next
+    ) const;
+};
+
+}
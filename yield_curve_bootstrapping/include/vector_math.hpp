@@ -0,0 +1,147 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace yield_curve {
+namespace detail {
+
+constexpr double LOG2E = 1.4426950408889634;
+constexpr double LN2_HI = 6.93147180369123816490e-01;
+constexpr double LN2_LO = 1.90821492927058770002e-10;
+constexpr double ROUND = 6755399441055744.0;
+
+inline double scale_by_exponent(double shifted) {
+    int64_t bits;
+    std::memcpy(&bits, &shifted, sizeof(bits));
+    int64_t scale_bits = (bits - 0x4338000000000000LL + 1023) << 52;
+    double scale;
+    std::memcpy(&scale, &scale_bits, sizeof(scale));
+    return scale;
+}
+
+inline double batch_exp(double x) {
+    double below = x < -708.0 ? 1.0 : 0.0;
+    double above = x > 709.0 ? 1.0 : 0.0;
+    x -= below * (x + 708.0) + above * (x - 709.0);
+    
+    double shifted = x * LOG2E + ROUND;
+    double n = shifted - ROUND;
+    double r = (x - n * LN2_HI) - n * LN2_LO;
+    
+    double p = 1.0 / 6227020800.0;
+    p = p * r + 1.0 / 479001600.0;
+    p = p * r + 1.0 / 39916800.0;
+    p = p * r + 1.0 / 3628800.0;
+    p = p * r + 1.0 / 362880.0;
+    p = p * r + 1.0 / 40320.0;
+    p = p * r + 1.0 / 5040.0;
+    p = p * r + 1.0 / 720.0;
+    p = p * r + 1.0 / 120.0;
+    p = p * r + 1.0 / 24.0;
+    p = p * r + 1.0 / 6.0;
+    p = p * r + 0.5;
+    p = p * r + 1.0;
+    p = p * r + 1.0;
+    
+    return p * scale_by_exponent(shifted);
+}
+
+inline double batch_expm1(double x) {
+    double below = x < -708.0 ? 1.0 : 0.0;
+    double above = x > 709.0 ? 1.0 : 0.0;
+    x -= below * (x + 708.0) + above * (x - 709.0);
+    
+    double shifted = x * LOG2E + ROUND;
+    double n = shifted - ROUND;
+    double r = (x - n * LN2_HI) - n * LN2_LO;
+    
+    double p = 1.0 / 87178291200.0;
+    p = p * r + 1.0 / 6227020800.0;
+    p = p * r + 1.0 / 479001600.0;
+    p = p * r + 1.0 / 39916800.0;
+    p = p * r + 1.0 / 3628800.0;
+    p = p * r + 1.0 / 362880.0;
+    p = p * r + 1.0 / 40320.0;
+    p = p * r + 1.0 / 5040.0;
+    p = p * r + 1.0 / 720.0;
+    p = p * r + 1.0 / 120.0;
+    p = p * r + 1.0 / 24.0;
+    p = p * r + 1.0 / 6.0;
+    p = p * r + 0.5;
+    p = p * r + 1.0;
+    
+    double scale = scale_by_exponent(shifted);
+    return scale * (p * r) + (scale - 1.0);
+}
+
+inline double batch_log(double x) {
+    constexpr uint64_t SQRT_HALF_BITS = 0x3FE6A09E667F3BCDULL;
+    constexpr uint64_t BIAS = 1ULL << 62;
+    constexpr uint64_t MAGIC_BITS = 0x4330000000000000ULL;
+    constexpr double MAGIC = 4503599627370496.0 + 1024.0;
+    
+    uint64_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+    uint64_t biased = (bits - SQRT_HALF_BITS + BIAS) >> 52;
+    uint64_t mantissa_bits = bits - (biased << 52) + BIAS;
+    uint64_t exponent_bits = MAGIC_BITS | biased;
+    
+    double f;
+    double k;
+    std::memcpy(&f, &mantissa_bits, sizeof(f));
+    std::memcpy(&k, &exponent_bits, sizeof(k));
+    k -= MAGIC;
+    
+    double s = (f - 1.0) / (f + 1.0);
+    double z = s * s;
+    
+    double p = 1.0 / 23.0;
+    p = p * z + 1.0 / 21.0;
+    p = p * z + 1.0 / 19.0;
+    p = p * z + 1.0 / 17.0;
+    p = p * z + 1.0 / 15.0;
+    p = p * z + 1.0 / 13.0;
+    p = p * z + 1.0 / 11.0;
+    p = p * z + 1.0 / 9.0;
+    p = p * z + 1.0 / 7.0;
+    p = p * z + 1.0 / 5.0;
+    p = p * z + 1.0 / 3.0;
+    
+    double log_f = 2.0 * s + 2.0 * s * z * p;
+    return k * LN2_HI + (log_f + k * LN2_LO);
+}
+
+inline double batch_log1p(double x) {
+    double w = 1.0 + x;
+    double correction = x - (w - 1.0);
+    return batch_log(w) + correction / w;
+}
+
+template <typename Scalar>
+Scalar batch_exp(const Scalar& x) {
+    using std::exp;
+    return exp(x);
+}
+
+template <typename Scalar>
+Scalar batch_expm1(const Scalar& x) {
+    using std::expm1;
+    return expm1(x);
+}
+
+template <typename Scalar>
+Scalar batch_log(const Scalar& x) {
+    using std::log;
+    return log(x);
+}
+
+template <typename Scalar>
+Scalar batch_log1p(const Scalar& x) {
+    using std::log1p;
+    return log1p(x);
+}
+
+}
+}
@@ -20,7 +20,14 @@ public:
     
     double get_forward_rate(double t1, double t2) const;
     
-    double get_instantaneous_forward(double t, double dt = 1e-6) const;
+    double get_instantaneous_forward(double t) const;
+    
+    [[deprecated("forwards are analytic; the step size is ignored")]]
+    double get_instantaneous_forward(double t, double /*dt*/) const { return get_instantaneous_forward(t); }
+    
+    std::vector<double> get_discount_factors(const std::vector<double>& times) const;
+    
+    std::vector<double> get_zero_rates(const std::vector<double>& times) const;
     
     const std::vector<double>& times() const { return times_; }
     const std::vector<double>& discount_factors() const { return discount_factors_; }
@@ -29,14 +36,23 @@ public:
     
     void apply_cubic_spline_smoothing();
     
+    void set_spline(const CubicSpline& spline);
+    
+    bool is_spline_smoothed() const { return use_spline_ && spline_ && spline_->is_fitted(); }
+    
+    const CubicSpline* spline() const { return is_spline_smoothed() ? spline_.get() : nullptr; }
+    
     bool has_arbitrage() const;
     
     CompoundingType compounding_type() const { return compounding_type_; }
     
+    InterpolationType interpolation_type() const { return interpolation_type_; }
+    
 private:
     std::vector<double> times_;
     std::vector<double> discount_factors_;
     CompoundingType compounding_type_;
+    InterpolationType interpolation_type_;
     std::unique_ptr<Interpolator> interpolator_;
     std::unique_ptr<CubicSpline> spline_;
     bool use_spline_ = false;
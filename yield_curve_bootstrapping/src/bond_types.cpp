@@ -18,6 +18,23 @@ std::string compounding_type_string(CompoundingType type) {
     }
 }
 
+std::vector<double> payment_schedule(double start, double maturity, int frequency) {
+    std::vector<double> times;
+    double dt = 1.0 / frequency;
+    
+    for (int k = 1; start + k * dt <= maturity + 1e-10; ++k) {
+        times.push_back(start + k * dt);
+    }
+    
+    if (times.empty() || times.back() < maturity - 1e-10) {
+        times.push_back(maturity);
+    } else {
+        times.back() = maturity;
+    }
+    
+    return times;
+}
+
 std::vector<double> BondData::get_payment_times() const {
     std::vector<double> times;
     double dt = 1.0 / payment_frequency;
@@ -46,4 +63,12 @@ std::vector<double> BondData::get_cash_flows() const {
     return cash_flows;
 }
 
+std::vector<double> SwapData::get_fixed_payment_times() const {
+    return payment_schedule(start, maturity, fixed_frequency);
+}
+
+std::vector<double> SwapData::get_float_payment_times() const {
+    return payment_schedule(start, maturity, float_frequency);
+}
+
 }
@@ -0,0 +1,172 @@
+#include "bond_universe.hpp"
+#include "discount_factor.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace yield_curve {
+
+BondUniverse::BondUniverse(CompoundingType yield_compounding)
+    : yield_compounding_(yield_compounding), offsets_{0} {
+    DiscountFactor::periods_per_year(yield_compounding);
+}
+
+size_t BondUniverse::add(const BondData& bond) {
+    if (bond.maturity <= 0 || bond.payment_frequency <= 0) {
+        throw std::invalid_argument("Invalid bond data");
+    }
+    
+    if (bond.market_price <= 0 || bond.face_value <= 0 || bond.coupon_rate < 0) {
+        throw std::invalid_argument("Invalid bond data");
+    }
+    
+    std::vector<double> times = bond.get_payment_times();
+    std::vector<double> cash_flows = bond.get_cash_flows();
+    if (times.empty()) {
+        throw std::invalid_argument("Bond has no cash flows");
+    }
+    
+    times_.insert(times_.end(), times.begin(), times.end());
+    cash_flows_.insert(cash_flows_.end(), cash_flows.begin(), cash_flows.end());
+    offsets_.push_back(times_.size());
+    prices_.push_back(bond.market_price);
+    
+    double coupon = bond.coupon_rate * bond.face_value;
+    double approx = (coupon + (bond.face_value - bond.market_price) / bond.maturity) /
+                    (0.5 * (bond.face_value + bond.market_price));
+    initial_yields_.push_back(std::log1p(std::max(approx, -0.5)));
+    
+    return prices_.size() - 1;
+}
+
+double BondUniverse::to_continuous(double yield) const {
+    double m = DiscountFactor::periods_per_year(yield_compounding_);
+    if (m == 0.0) {
+        return yield;
+    }
+    if (yield <= -m) {
+        throw std::invalid_argument("Yield below compounding limit");
+    }
+    return m * std::log1p(yield / m);
+}
+
+double BondUniverse::from_continuous(double rate) const {
+    double m = DiscountFactor::periods_per_year(yield_compounding_);
+    return (m == 0.0) ? rate : m * std::expm1(rate / m);
+}
+
+void BondUniverse::check_size(const std::vector<double>& values) const {
+    if (values.size() != size()) {
+        throw std::invalid_argument("Input size must match bond count");
+    }
+}
+
+std::vector<double> BondUniverse::price_from_yield(const std::vector<double>& yields) const {
+    check_size(yields);
+    
+    std::vector<double> prices(size());
+    for (size_t b = 0; b < size(); ++b) {
+        double rate = to_continuous(yields[b]);
+        double price = 0.0;
+        for (size_t i = offsets_[b]; i < offsets_[b + 1]; ++i) {
+            price += cash_flows_[i] * std::exp(-rate * times_[i]);
+        }
+        prices[b] = price;
+    }
+    
+    return prices;
+}
+
+std::vector<double> BondUniverse::yield_to_maturity() const {
+    return yield_to_maturity(prices_);
+}
+
+std::vector<double> BondUniverse::yield_to_maturity(const std::vector<double>& prices) const {
+    check_size(prices);
+    
+    std::vector<double> rates = solve_rates(cash_flows_, prices, initial_yields_);
+    for (double& rate : rates) {
+        rate = from_continuous(rate);
+    }
+    
+    return rates;
+}
+
+std::vector<double> BondUniverse::z_spread(const YieldCurve& curve) const {
+    return z_spread(curve, prices_);
+}
+
+std::vector<double> BondUniverse::z_spread(
+    const YieldCurve& curve,
+    const std::vector<double>& prices
+) const {
+    check_size(prices);
+    
+    std::vector<double> weights = curve.get_discount_factors(times_);
+    for (size_t i = 0; i < weights.size(); ++i) {
+        weights[i] *= cash_flows_[i];
+    }
+    
+    return solve_rates(weights, prices, std::vector<double>(size(), 0.0));
+}
+
+std::vector<double> BondUniverse::solve_rates(
+    const std::vector<double>& weights,
+    const std::vector<double>& prices,
+    const std::vector<double>& guesses
+) const {
+    for (double price : prices) {
+        if (!(price > 0)) {
+            throw std::invalid_argument("Prices must be positive");
+        }
+    }
+    
+    std::vector<double> rates(size());
+    
+    for (size_t b = 0; b < size(); ++b) {
+        double rate = std::min(std::max(guesses[b], MIN_RATE), MAX_RATE);
+        double lo = MIN_RATE;
+        double hi = MAX_RATE;
+        double residual = 0.0;
+        bool converged = false;
+        
+        for (int iter = 0; iter < MAX_ITERATIONS && !converged; ++iter) {
+            double value = 0.0;
+            double duration = 0.0;
+            for (size_t i = offsets_[b]; i < offsets_[b + 1]; ++i) {
+                double pv = weights[i] * std::exp(-rate * times_[i]);
+                value += pv;
+                duration += times_[i] * pv;
+            }
+            
+            residual = value - prices[b];
+            
+            if (std::abs(residual) < TOLERANCE * prices[b]) {
+                converged = true;
+                break;
+            }
+            
+            if (residual > 0) {
+                lo = rate;
+            } else {
+                hi = rate;
+            }
+            
+            double next = rate + residual / duration;
+            if (!(next > lo && next < hi)) {
+                next = 0.5 * (lo + hi);
+            }
+            
+            converged = std::abs(next - rate) < TOLERANCE;
+            rate = next;
+        }
+        
+        bool solved = converged && std::abs(residual) <= 1e-8 * prices[b];
+        rates[b] = solved ? rate : std::numeric_limits<double>::quiet_NaN();
+    }
+    
+    return rates;
+}
+
+}
@@ -0,0 +1,411 @@
+#include "bspline_fitter.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace yield_curve {
+
+BSplineBasis::BSplineBasis(const std::vector<double>& breakpoints)
+    : breakpoints_(breakpoints) {
+    if (breakpoints.size() < 2) {
+        throw std::invalid_argument("Need at least 2 breakpoints for B-spline basis");
+    }
+
+    for (size_t i = 1; i < breakpoints.size(); ++i) {
+        if (breakpoints[i] <= breakpoints[i - 1]) {
+            throw std::invalid_argument("Breakpoints must be strictly increasing");
+        }
+    }
+
+    knots_.assign(DEGREE, breakpoints.front());
+    knots_.insert(knots_.end(), breakpoints.begin(), breakpoints.end());
+    knots_.insert(knots_.end(), DEGREE, breakpoints.back());
+}
+
+size_t BSplineBasis::find_span(double t) const {
+    size_t n = size();
+
+    if (t >= knots_[n]) {
+        return n - 1;
+    }
+
+    if (t <= knots_[DEGREE]) {
+        return DEGREE;
+    }
+
+    auto it = std::upper_bound(knots_.begin() + DEGREE, knots_.begin() + n + 1, t);
+    return static_cast<size_t>(std::distance(knots_.begin(), it)) - 1;
+}
+
+size_t BSplineBasis::evaluate(double t, std::array<double, DEGREE + 1>& values) const {
+    t = std::clamp(t, t_min(), t_max());
+    size_t span = find_span(t);
+
+    std::array<double, DEGREE + 1> left{};
+    std::array<double, DEGREE + 1> right{};
+    values[0] = 1.0;
+
+    for (int j = 1; j <= DEGREE; ++j) {
+        left[j] = t - knots_[span + 1 - j];
+        right[j] = knots_[span + j] - t;
+        double saved = 0.0;
+
+        for (int r = 0; r < j; ++r) {
+            double temp = values[r] / (right[r + 1] + left[j - r]);
+            values[r] = saved + right[r + 1] * temp;
+            saved = left[j - r] * temp;
+        }
+        values[j] = saved;
+    }
+
+    return span - DEGREE;
+}
+
+size_t BSplineBasis::second_derivative(double t, std::array<double, DEGREE + 1>& values) const {
+    t = std::clamp(t, t_min(), t_max());
+    size_t span = find_span(t);
+
+    std::array<double, DEGREE> lower{};
+    std::array<double, DEGREE + 1> left{};
+    std::array<double, DEGREE + 1> right{};
+    lower[0] = 1.0;
+
+    for (int j = 1; j < DEGREE - 1; ++j) {
+        left[j] = t - knots_[span + 1 - j];
+        right[j] = knots_[span + j] - t;
+        double saved = 0.0;
+
+        for (int r = 0; r < j; ++r) {
+            double temp = lower[r] / (right[r + 1] + left[j - r]);
+            lower[r] = saved + right[r + 1] * temp;
+            saved = left[j - r] * temp;
+        }
+        lower[j] = saved;
+    }
+
+    std::array<double, DEGREE> first{};
+    for (int r = 0; r < DEGREE; ++r) {
+        size_t i = span - (DEGREE - 1) + r;
+        double a = (r > 0) ? lower[r - 1] / (knots_[i + DEGREE - 1] - knots_[i]) : 0.0;
+        double b = (r < DEGREE - 1) ? lower[r] / (knots_[i + DEGREE] - knots_[i + 1]) : 0.0;
+        first[r] = (DEGREE - 1) * (a - b);
+    }
+
+    for (int r = 0; r <= DEGREE; ++r) {
+        size_t i = span - DEGREE + r;
+        double a = (r > 0) ? first[r - 1] / (knots_[i + DEGREE] - knots_[i]) : 0.0;
+        double b = (r < DEGREE) ? first[r] / (knots_[i + DEGREE + 1] - knots_[i + 1]) : 0.0;
+        values[r] = DEGREE * (a - b);
+    }
+
+    return span - DEGREE;
+}
+
+void BandedCholesky::factorize(std::vector<double> band, size_t n, size_t bandwidth) {
+    if (band.size() != n * (bandwidth + 1)) {
+        throw std::invalid_argument("Band storage size mismatch");
+    }
+
+    l_ = std::move(band);
+    n_ = n;
+    bandwidth_ = bandwidth;
+
+    for (size_t i = 0; i < n_; ++i) {
+        size_t j_start = (i > bandwidth_) ? i - bandwidth_ : 0;
+
+        for (size_t j = j_start; j <= i; ++j) {
+            double sum = at(i, j);
+            for (size_t k = j_start; k < j; ++k) {
+                if (j - k <= bandwidth_) {
+                    sum -= at(i, k) * at(j, k);
+                }
+            }
+
+            if (i == j) {
+                if (sum <= 0.0) {
+                    throw std::runtime_error("Normal equations not positive definite - increase smoothing");
+                }
+                at(i, i) = std::sqrt(sum);
+            } else {
+                at(i, j) = sum / at(j, j);
+            }
+        }
+    }
+}
+
+void BandedCholesky::solve(std::vector<double>& rhs) const {
+    if (rhs.size() != n_) {
+        throw std::invalid_argument("Right-hand side size mismatch");
+    }
+
+    for (size_t i = 0; i < n_; ++i) {
+        size_t k_start = (i > bandwidth_) ? i - bandwidth_ : 0;
+        double sum = rhs[i];
+        for (size_t k = k_start; k < i; ++k) {
+            sum -= at(i, k) * rhs[k];
+        }
+        rhs[i] = sum / at(i, i);
+    }
+
+    for (size_t ii = n_; ii-- > 0;) {
+        size_t k_end = std::min(n_ - 1, ii + bandwidth_);
+        double sum = rhs[ii];
+        for (size_t k = ii + 1; k <= k_end; ++k) {
+            sum -= at(k, ii) * rhs[k];
+        }
+        rhs[ii] = sum / at(ii, ii);
+    }
+}
+
+BSplineCurveFitter::BSplineCurveFitter(const std::vector<double>& breakpoints, double smoothing)
+    : basis_(breakpoints), smoothing_(smoothing) {
+    if (smoothing < 0) {
+        throw std::invalid_argument("Smoothing parameter must be non-negative");
+    }
+
+    if (breakpoints.front() != 0.0) {
+        throw std::invalid_argument("First breakpoint must be zero");
+    }
+}
+
+void BSplineCurveFitter::fit(const std::vector<BondData>& bonds) {
+    fit(bonds, std::vector<double>(bonds.size(), 1.0));
+}
+
+void BSplineCurveFitter::fit(const std::vector<BondData>& bonds, const std::vector<double>& weights) {
+    if (bonds.empty()) {
+        throw std::invalid_argument("Invalid bond data");
+    }
+
+    if (weights.size() != bonds.size()) {
+        throw std::invalid_argument("Weights and bonds size mismatch");
+    }
+
+    for (double w : weights) {
+        if (w <= 0) {
+            throw std::invalid_argument("Weights must be positive");
+        }
+    }
+
+    weights_ = weights;
+    build_design(bonds);
+    factorize_normal_equations();
+    solve_coefficients();
+}
+
+void BSplineCurveFitter::refit_prices(const std::vector<double>& market_prices) {
+    if (!fitted_) {
+        throw std::runtime_error("Fitter not fitted");
+    }
+
+    if (market_prices.size() != prices_.size()) {
+        throw std::invalid_argument("Price vector size mismatch");
+    }
+
+    prices_ = market_prices;
+    solve_coefficients();
+}
+
+void BSplineCurveFitter::build_design(const std::vector<BondData>& bonds) {
+    size_t m = bonds.size();
+    size_t n = basis_.size();
+
+    design_.assign(m * n, 0.0);
+    row_first_.assign(m, n);
+    row_last_.assign(m, 0);
+    prices_.resize(m);
+
+    std::array<double, BSplineBasis::DEGREE + 1> values;
+
+    for (size_t i = 0; i < m; ++i) {
+        const BondData& bond = bonds[i];
+
+        if (bond.maturity <= 0 || bond.payment_frequency <= 0 || bond.market_price <= 0) {
+            throw std::invalid_argument("Invalid bond data");
+        }
+
+        if (bond.maturity > basis_.t_max() + 1e-10) {
+            throw std::invalid_argument("Bond maturity beyond last breakpoint");
+        }
+
+        std::vector<double> times = bond.get_payment_times();
+        std::vector<double> cash_flows = bond.get_cash_flows();
+        double* row = &design_[i * n];
+
+        for (size_t k = 0; k < times.size(); ++k) {
+            size_t first = basis_.evaluate(times[k], values);
+            for (size_t r = 0; r < values.size(); ++r) {
+                row[first + r] += cash_flows[k] * values[r];
+            }
+            row_first_[i] = std::min(row_first_[i], first);
+            row_last_[i] = std::max(row_last_[i], first + values.size() - 1);
+        }
+
+        prices_[i] = bond.market_price;
+    }
+}
+
+void BSplineCurveFitter::factorize_normal_equations() {
+    size_t m = prices_.size();
+    size_t n = basis_.size();
+    size_t nf = n - 1;
+
+    size_t bandwidth = BSplineBasis::DEGREE;
+    for (size_t i = 0; i < m; ++i) {
+        size_t first = std::max<size_t>(row_first_[i], 1);
+        if (row_last_[i] >= first) {
+            bandwidth = std::max(bandwidth, row_last_[i] - first);
+        }
+    }
+    bandwidth = std::min(bandwidth, nf - 1);
+
+    std::vector<double> band(nf * (bandwidth + 1), 0.0);
+    penalty_rhs_.assign(nf, 0.0);
+
+    for (size_t i = 0; i < m; ++i) {
+        const double* row = &design_[i * n];
+        double w = weights_[i];
+        size_t first = std::max<size_t>(row_first_[i], 1);
+
+        for (size_t a = first; a <= row_last_[i]; ++a) {
+            for (size_t b = first; b <= a; ++b) {
+                band[(a - 1) * (bandwidth + 1) + (a - b)] += w * row[a] * row[b];
+            }
+            penalty_rhs_[a - 1] -= w * row[a] * row[0];
+        }
+    }
+
+    const std::vector<double>& bp = basis_.breakpoints();
+    const double gauss_offset = 0.5 / std::sqrt(3.0);
+    std::array<double, BSplineBasis::DEGREE + 1> values;
+
+    for (size_t k = 0; k + 1 < bp.size(); ++k) {
+        double mid = 0.5 * (bp[k] + bp[k + 1]);
+        double h = bp[k + 1] - bp[k];
+
+        for (double offset : {-gauss_offset, gauss_offset}) {
+            size_t first = basis_.second_derivative(mid + offset * h, values);
+            double w = 0.5 * h * smoothing_;
+
+            for (size_t r = 0; r < values.size(); ++r) {
+                size_t a = first + r;
+                for (size_t s = 0; s <= r; ++s) {
+                    size_t b = first + s;
+                    double term = w * values[r] * values[s];
+                    if (b == 0) {
+                        if (a > 0) {
+                            penalty_rhs_[a - 1] -= term;
+                        }
+                    } else {
+                        band[(a - 1) * (bandwidth + 1) + (a - b)] += term;
+                    }
+                }
+            }
+        }
+    }
+
+    solver_.factorize(std::move(band), nf, bandwidth);
+}
+
+void BSplineCurveFitter::solve_coefficients() {
+    size_t m = prices_.size();
+    size_t n = basis_.size();
+
+    std::vector<double> rhs = penalty_rhs_;
+
+    for (size_t i = 0; i < m; ++i) {
+        const double* row = &design_[i * n];
+        double wp = weights_[i] * prices_[i];
+        size_t first = std::max<size_t>(row_first_[i], 1);
+
+        for (size_t a = first; a <= row_last_[i]; ++a) {
+            rhs[a - 1] += wp * row[a];
+        }
+    }
+
+    solver_.solve(rhs);
+
+    coefficients_.resize(n);
+    coefficients_[0] = 1.0;
+    std::copy(rhs.begin(), rhs.end(), coefficients_.begin() + 1);
+
+    fitted_ = true;
+}
+
+double BSplineCurveFitter::get_discount_factor(double time) const {
+    if (!fitted_) {
+        throw std::runtime_error("Fitter not fitted");
+    }
+
+    if (time < 0) {
+        throw std::invalid_argument("Time must be non-negative");
+    }
+
+    if (time < 1e-10) {
+        return 1.0;
+    }
+
+    std::array<double, BSplineBasis::DEGREE + 1> values;
+
+    if (time > basis_.t_max()) {
+        const std::vector<double>& bp = basis_.breakpoints();
+        double t1 = bp[bp.size() - 2];
+        double t2 = bp.back();
+        double df1 = get_discount_factor(t1);
+        double df2 = get_discount_factor(t2);
+
+        double forward_rate = -std::log(df2 / df1) / (t2 - t1);
+        return df2 * std::exp(-forward_rate * (time - t2));
+    }
+
+    size_t first = basis_.evaluate(time, values);
+    double df = 0.0;
+    for (size_t r = 0; r < values.size(); ++r) {
+        df += coefficients_[first + r] * values[r];
+    }
+    return df;
+}
+
+double BSplineCurveFitter::model_price(size_t bond_index) const {
+    if (!fitted_) {
+        throw std::runtime_error("Fitter not fitted");
+    }
+
+    if (bond_index >= prices_.size()) {
+        throw std::out_of_range("Bond index out of range");
+    }
+
+    size_t n = basis_.size();
+    const double* row = &design_[bond_index * n];
+
+    double price = 0.0;
+    for (size_t a = row_first_[bond_index]; a <= row_last_[bond_index]; ++a) {
+        price += row[a] * coefficients_[a];
+    }
+    return price;
+}
+
+double BSplineCurveFitter::rms_price_error() const {
+    double sum_sq = 0.0;
+    for (size_t i = 0; i < prices_.size(); ++i) {
+        double err = model_price(i) - prices_[i];
+        sum_sq += err * err;
+    }
+    return std::sqrt(sum_sq / prices_.size());
+}
+
+YieldCurve BSplineCurveFitter::to_curve(
+    const std::vector<double>& pillars,
+    CompoundingType type,
+    InterpolationType interp_type
+) const {
+    YieldCurve curve(type, interp_type);
+
+    for (double t : pillars) {
+        curve.add_point(t, get_discount_factor(t));
+    }
+
+    return curve;
+}
+
+}
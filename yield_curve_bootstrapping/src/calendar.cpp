@@ -0,0 +1,234 @@
+#include "calendar.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace yield_curve {
+
+namespace {
+
+size_t lowest_set_bit(uint64_t bits) {
+#if defined(__GNUC__)
+    return static_cast<size_t>(__builtin_ctzll(bits));
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+    unsigned long position;
+    _BitScanForward64(&position, bits);
+    return static_cast<size_t>(position);
+#else
+    size_t position = 0;
+    while ((bits & 1) == 0) {
+        bits >>= 1;
+        ++position;
+    }
+    return position;
+#endif
+}
+
+size_t highest_set_bit(uint64_t bits) {
+#if defined(__GNUC__)
+    return 63 - static_cast<size_t>(__builtin_clzll(bits));
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+    unsigned long position;
+    _BitScanReverse64(&position, bits);
+    return static_cast<size_t>(position);
+#else
+    size_t position = 63;
+    while ((bits >> position) == 0) {
+        --position;
+    }
+    return position;
+#endif
+}
+
+int popcount(uint64_t bits) {
+#if defined(__GNUC__)
+    return __builtin_popcountll(bits);
+#else
+    bits = bits - ((bits >> 1) & 0x5555555555555555ULL);
+    bits = (bits & 0x3333333333333333ULL) + ((bits >> 2) & 0x3333333333333333ULL);
+    bits = (bits + (bits >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return static_cast<int>((bits * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+Date easter_sunday(int year) {
+    int a = year % 19;
+    int b = year / 100;
+    int c = year % 100;
+    int d = b / 4;
+    int e = b % 4;
+    int f = (b + 8) / 25;
+    int g = (b - f + 1) / 3;
+    int h = (19 * a + b - d - g + 15) % 30;
+    int i = c / 4;
+    int k = c % 4;
+    int l = (32 + 2 * e + 2 * i - h - k) % 7;
+    int m = (a + 11 * h + 22 * l) / 451;
+    int month = (h + l - 7 * m + 114) / 31;
+    int day = (h + l - 7 * m + 114) % 31 + 1;
+    return Date(year, static_cast<unsigned>(month), static_cast<unsigned>(day));
+}
+
+}
+
+HolidayCalendar::HolidayCalendar(int first_year, int last_year, const std::vector<Weekday>& weekend)
+    : first_year_(first_year), last_year_(last_year) {
+    if (last_year < first_year) {
+        throw std::invalid_argument("Calendar last year must not precede first year");
+    }
+    
+    first_serial_ = Date(first_year, 1, 1).serial();
+    end_serial_ = Date(last_year + 1, 1, 1).serial();
+    
+    size_t num_days = static_cast<size_t>(end_serial_ - first_serial_);
+    business_days_.assign((num_days + 63) / 64, 0);
+    
+    bool weekend_day[7] = {false, false, false, false, false, false, false};
+    for (Weekday w : weekend) {
+        weekend_day[static_cast<int>(w)] = true;
+    }
+    
+    for (size_t i = 0; i < num_days; ++i) {
+        if (!weekend_day[static_cast<int>(from_index(i).weekday())]) {
+            business_days_[i >> 6] |= uint64_t(1) << (i & 63);
+        }
+    }
+}
+
+HolidayCalendar HolidayCalendar::weekends_only(int first_year, int last_year) {
+    return HolidayCalendar(first_year, last_year);
+}
+
+HolidayCalendar HolidayCalendar::target(int first_year, int last_year) {
+    HolidayCalendar calendar(first_year, last_year);
+    
+    calendar.add_fixed_holiday(1, 1);
+    calendar.add_fixed_holiday(5, 1);
+    calendar.add_fixed_holiday(12, 25);
+    calendar.add_fixed_holiday(12, 26);
+    
+    for (int year = first_year; year <= last_year; ++year) {
+        Date easter = easter_sunday(year);
+        calendar.add_holiday(easter.add_days(-2));
+        calendar.add_holiday(easter.add_days(1));
+    }
+    
+    return calendar;
+}
+
+size_t HolidayCalendar::index(const Date& date) const {
+    if (date.serial() < first_serial_ || date.serial() >= end_serial_) {
+        throw std::out_of_range("Date outside calendar range: " + date.to_string());
+    }
+    
+    return static_cast<size_t>(date.serial() - first_serial_);
+}
+
+void HolidayCalendar::add_holiday(const Date& date) {
+    size_t i = index(date);
+    business_days_[i >> 6] &= ~(uint64_t(1) << (i & 63));
+}
+
+void HolidayCalendar::add_fixed_holiday(unsigned month, unsigned day) {
+    for (int year = first_year_; year <= last_year_; ++year) {
+        if (day <= Date::days_in_month(year, month)) {
+            add_holiday(Date(year, month, day));
+        }
+    }
+}
+
+bool HolidayCalendar::is_business_day(const Date& date) const {
+    size_t i = index(date);
+    return (business_days_[i >> 6] >> (i & 63)) & 1;
+}
+
+Date HolidayCalendar::next_business_day(const Date& date) const {
+    size_t i = index(date);
+    size_t word = i >> 6;
+    uint64_t bits = business_days_[word] & (~uint64_t(0) << (i & 63));
+    
+    while (bits == 0) {
+        if (++word == business_days_.size()) {
+            throw std::out_of_range("No business day before calendar end");
+        }
+        bits = business_days_[word];
+    }
+    
+    return from_index(word * 64 + lowest_set_bit(bits));
+}
+
+Date HolidayCalendar::previous_business_day(const Date& date) const {
+    size_t i = index(date);
+    size_t word = i >> 6;
+    uint64_t bits = business_days_[word] & (~uint64_t(0) >> (63 - (i & 63)));
+    
+    while (bits == 0) {
+        if (word-- == 0) {
+            throw std::out_of_range("No business day after calendar start");
+        }
+        bits = business_days_[word];
+    }
+    
+    return from_index(word * 64 + highest_set_bit(bits));
+}
+
+Date HolidayCalendar::adjust(const Date& date, BusinessDayConvention convention) const {
+    switch (convention) {
+        case BusinessDayConvention::UNADJUSTED:
+            return date;
+        case BusinessDayConvention::FOLLOWING:
+            return next_business_day(date);
+        case BusinessDayConvention::PRECEDING:
+            return previous_business_day(date);
+        case BusinessDayConvention::MODIFIED_FOLLOWING: {
+            Date adjusted = next_business_day(date);
+            return adjusted.month() == date.month() ? adjusted : previous_business_day(date);
+        }
+        case BusinessDayConvention::MODIFIED_PRECEDING: {
+            Date adjusted = previous_business_day(date);
+            return adjusted.month() == date.month() ? adjusted : next_business_day(date);
+        }
+        default:
+            throw std::invalid_argument("Unknown business day convention");
+    }
+}
+
+Date HolidayCalendar::advance(const Date& date, int business_days) const {
+    Date result = date;
+    
+    for (; business_days > 0; --business_days) {
+        result = next_business_day(result.add_days(1));
+    }
+    
+    for (; business_days < 0; ++business_days) {
+        result = previous_business_day(result.add_days(-1));
+    }
+    
+    return result;
+}
+
+int HolidayCalendar::business_days_between(const Date& from, const Date& to) const {
+    if (to < from) {
+        return -business_days_between(to, from);
+    }
+    
+    size_t begin = index(from);
+    size_t end = (to.serial() == end_serial_) ? static_cast<size_t>(end_serial_ - first_serial_) : index(to);
+    int count = 0;
+    
+    while (begin < end) {
+        size_t word = begin >> 6;
+        size_t offset = begin & 63;
+        size_t span = std::min<size_t>(64 - offset, end - begin);
+        uint64_t mask = (span == 64) ? ~uint64_t(0) : ((uint64_t(1) << span) - 1) << offset;
+        count += popcount(business_days_[word] & mask);
+        begin += span;
+    }
+    
+    return count;
+}
+
+}
@@ -0,0 +1,252 @@
+#include "credit_bootstrapper.hpp"
+#include "parallel.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace yield_curve {
+
+CreditQuote CreditQuote::cds(double maturity, double spread, double recovery_rate,
+                             int payment_frequency) {
+    return {CreditInstrumentType::CDS, maturity, payment_frequency, recovery_rate,
+            spread, 0.0, 0.0, 1.0};
+}
+
+CreditQuote CreditQuote::risky_bond(const BondData& bond, double recovery_rate) {
+    return {CreditInstrumentType::RISKY_BOND, bond.maturity, bond.payment_frequency,
+            recovery_rate, 0.0, bond.coupon_rate, bond.market_price, bond.face_value};
+}
+
+std::vector<double> CreditQuote::get_payment_times() const {
+    return payment_schedule(0.0, maturity, payment_frequency);
+}
+
+CreditBootstrapper::CreditBootstrapper(const YieldCurve& risk_free_curve,
+                                       InterpolationType interp_type)
+    : risk_free_curve_(risk_free_curve), interpolation_type_(interp_type) {}
+
+HazardCurve CreditBootstrapper::bootstrap(const std::vector<CreditQuote>& quotes) const {
+    Scratch scratch;
+    return bootstrap_with(quotes, nullptr, scratch);
+}
+
+std::vector<HazardCurve> CreditBootstrapper::bootstrap_all(
+    const std::vector<std::vector<CreditQuote>>& issuers,
+    unsigned num_threads
+) const {
+    DiscountCache cache;
+    for (const auto& quotes : issuers) {
+        for (const auto& quote : quotes) {
+            if (quote.payment_frequency <= 0 || quote.maturity <= 0) {
+                throw std::invalid_argument("Invalid credit quote");
+            }
+            std::vector<double> times = quote.get_payment_times();
+            cache.times.insert(cache.times.end(), times.begin(), times.end());
+        }
+    }
+    
+    std::sort(cache.times.begin(), cache.times.end());
+    cache.times.erase(
+        std::unique(cache.times.begin(), cache.times.end(),
+                    [](double a, double b) { return b - a < 1e-12; }),
+        cache.times.end());
+    cache.discount_factors = risk_free_curve_.get_discount_factors(cache.times);
+    
+    std::vector<HazardCurve> curves(issuers.size());
+    
+    detail::parallel_for(issuers.size(), num_threads, [&](size_t begin, size_t end) {
+        Scratch scratch;
+        for (size_t i = begin; i < end; ++i) {
+            curves[i] = bootstrap_with(issuers[i], &cache, scratch);
+        }
+    });
+    
+    return curves;
+}
+
+HazardCurve CreditBootstrapper::bootstrap_with(
+    const std::vector<CreditQuote>& quotes,
+    const DiscountCache* cache,
+    Scratch& scratch
+) const {
+    if (!validate_quotes(quotes)) {
+        throw std::invalid_argument("Invalid credit quote");
+    }
+    
+    std::vector<CreditQuote> sorted = quotes;
+    std::sort(sorted.begin(), sorted.end(),
+        [](const CreditQuote& a, const CreditQuote& b) {
+            return a.maturity < b.maturity;
+        });
+    
+    HazardCurve curve(interpolation_type_);
+    std::unique_ptr<Interpolator> interpolator = create_interpolator(interpolation_type_);
+    
+    for (const auto& quote : sorted) {
+        scratch.payment_times = quote.get_payment_times();
+        scratch.discount_factors.resize(scratch.payment_times.size());
+        for (size_t i = 0; i < scratch.payment_times.size(); ++i) {
+            scratch.discount_factors[i] = discount(scratch.payment_times[i], cache);
+        }
+        
+        double survival = solve_survival(quote, curve, *interpolator, scratch);
+        curve.add_point(quote.maturity, survival);
+    }
+    
+    return curve;
+}
+
+double CreditBootstrapper::solve_survival(
+    const CreditQuote& quote,
+    const HazardCurve& partial_curve,
+    const Interpolator& interpolator,
+    Scratch& scratch
+) const {
+    const std::vector<double>& times = scratch.payment_times;
+    double last_pillar = partial_curve.times().back();
+    
+    scratch.survival.resize(times.size());
+    size_t first_unknown = 0;
+    while (first_unknown < times.size() && times[first_unknown] <= last_pillar) {
+        scratch.survival[first_unknown] = partial_curve.get_survival_probability(times[first_unknown]);
+        ++first_unknown;
+    }
+    
+    scratch.trial_times = partial_curve.times();
+    scratch.trial_times.push_back(quote.maturity);
+    scratch.trial_survival = partial_curve.survival_probabilities();
+    scratch.trial_survival.push_back(partial_curve.survival_probabilities().back());
+    
+    auto value_at = [&](double s) {
+        scratch.trial_survival.back() = s;
+        for (size_t i = first_unknown; i < times.size(); ++i) {
+            scratch.survival[i] = interpolator.interpolate(times[i], scratch.trial_times,
+                                                           scratch.trial_survival);
+        }
+        return leg_value(quote, scratch);
+    };
+    
+    double lo = SURVIVAL_FLOOR;
+    double hi = partial_curve.survival_probabilities().back();
+    double f_lo = value_at(lo);
+    double f_hi = value_at(hi);
+    
+    if (f_lo * f_hi > 0) {
+        throw std::runtime_error("Credit quote inconsistent with curve - possible arbitrage");
+    }
+    
+    int side = 0;
+    double s = hi;
+    for (int iter = 0; iter < MAX_ITERATIONS; ++iter) {
+        s = (lo * f_hi - hi * f_lo) / (f_hi - f_lo);
+        double f_s = value_at(s);
+        
+        if (std::abs(f_s) < TOLERANCE || hi - lo < TOLERANCE) {
+            break;
+        }
+        
+        if (f_s * f_hi > 0) {
+            hi = s;
+            f_hi = f_s;
+            if (side == 1) {
+                f_lo /= 2.0;
+            }
+            side = 1;
+        } else {
+            lo = s;
+            f_lo = f_s;
+            if (side == -1) {
+                f_hi /= 2.0;
+            }
+            side = -1;
+        }
+    }
+    
+    return s;
+}
+
+double CreditBootstrapper::leg_value(const CreditQuote& quote, const Scratch& scratch) const {
+    const std::vector<double>& times = scratch.payment_times;
+    const std::vector<double>& dfs = scratch.discount_factors;
+    const std::vector<double>& survival = scratch.survival;
+    
+    double prev_time = 0.0;
+    double prev_survival = 1.0;
+    double value = 0.0;
+    
+    if (quote.type == CreditInstrumentType::CDS) {
+        double premium = 0.0;
+        double protection = 0.0;
+        
+        for (size_t i = 0; i < times.size(); ++i) {
+            double accrual = times[i] - prev_time;
+            double default_prob = prev_survival - survival[i];
+            premium += accrual * dfs[i] * (survival[i] + 0.5 * default_prob);
+            protection += dfs[i] * default_prob;
+            prev_time = times[i];
+            prev_survival = survival[i];
+        }
+        
+        value = quote.spread * premium - (1.0 - quote.recovery_rate) * protection;
+    } else {
+        double coupon = quote.coupon_rate * quote.face_value / quote.payment_frequency;
+        double recovery = quote.recovery_rate * quote.face_value;
+        
+        for (size_t i = 0; i < times.size(); ++i) {
+            double cash_flow = (i + 1 == times.size()) ? coupon + quote.face_value : coupon;
+            value += cash_flow * dfs[i] * survival[i] + recovery * dfs[i] * (prev_survival - survival[i]);
+            prev_survival = survival[i];
+        }
+        
+        value -= quote.market_price;
+    }
+    
+    return value;
+}
+
+double CreditBootstrapper::instrument_value(const CreditQuote& quote, const HazardCurve& curve) const {
+    Scratch scratch;
+    scratch.payment_times = quote.get_payment_times();
+    for (double t : scratch.payment_times) {
+        scratch.discount_factors.push_back(discount(t, nullptr));
+        scratch.survival.push_back(curve.get_survival_probability(t));
+    }
+    return leg_value(quote, scratch);
+}
+
+double CreditBootstrapper::discount(double time, const DiscountCache* cache) const {
+    if (cache) {
+        auto it = std::lower_bound(cache->times.begin(), cache->times.end(), time - 1e-12);
+        if (it != cache->times.end() && std::abs(*it - time) < 1e-12) {
+            return cache->discount_factors[std::distance(cache->times.begin(), it)];
+        }
+    }
+    
+    return risk_free_curve_.get_discount_factor(time);
+}
+
+bool CreditBootstrapper::validate_quotes(const std::vector<CreditQuote>& quotes) const {
+    if (quotes.empty()) {
+        return false;
+    }
+    
+    for (const auto& quote : quotes) {
+        if (quote.maturity <= 0 || quote.payment_frequency <= 0) {
+            return false;
+        }
+        if (quote.recovery_rate < 0 || quote.recovery_rate >= 1.0) {
+            return false;
+        }
+        if (quote.type == CreditInstrumentType::CDS && quote.spread <= 0) {
+            return false;
+        }
+        if (quote.type == CreditInstrumentType::RISKY_BOND &&
+            (quote.market_price <= 0 || quote.face_value <= 0 || quote.coupon_rate < 0)) {
+            return false;
+        }
+    }
+    
+    return true;
+}
+
+}
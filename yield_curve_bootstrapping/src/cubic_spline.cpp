@@ -60,6 +60,31 @@ void CubicSpline::fit(const std::vector<double>& x, const std::vector<double>& y
     fitted_ = true;
 }
 
+void CubicSpline::load(
+    const std::vector<double>& x,
+    const std::vector<double>& a,
+    const std::vector<double>& b,
+    const std::vector<double>& c,
+    const std::vector<double>& d
+) {
+    if (x.size() < 2) {
+        throw std::invalid_argument("Need at least 2 points for spline");
+    }
+    
+    size_t n = x.size() - 1;
+    if (a.size() != n + 1 || c.size() != n + 1 || b.size() != n || d.size() != n) {
+        throw std::invalid_argument("Spline coefficient size mismatch");
+    }
+    
+    x_ = x;
+    y_ = a;
+    a_ = a;
+    b_ = b;
+    c_ = c;
+    d_ = d;
+    fitted_ = true;
+}
+
 double CubicSpline::evaluate(double x) const {
     if (!fitted_) {
         throw std::runtime_error("Spline not fitted");
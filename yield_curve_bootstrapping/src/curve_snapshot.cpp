@@ -0,0 +1,392 @@
+#include "curve_snapshot.hpp"
+#include "cubic_spline.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+#if defined(_WIN32)
+#include <iterator>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace yield_curve {
+
+namespace {
+
+constexpr char MAGIC[8] = {'Y', 'C', 'S', 'N', 'A', 'P', '\0', '\0'};
+constexpr uint32_t ENDIAN_TAG = 0x01020304;
+constexpr size_t ALIGNMENT = 64;
+
+struct SnapshotHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t endian_tag;
+    uint32_t curve_count;
+    uint32_t reserved;
+    uint64_t directory_offset;
+    uint64_t file_size;
+    uint8_t padding[24];
+};
+
+struct DirectoryEntry {
+    char name[48];
+    uint64_t offset;
+    uint64_t size;
+};
+
+struct RecordHeader {
+    uint32_t num_points;
+    uint32_t array_stride;
+    uint8_t compounding;
+    uint8_t interpolation;
+    uint8_t has_spline;
+    uint8_t padding[53];
+};
+
+static_assert(sizeof(SnapshotHeader) == ALIGNMENT, "Snapshot header must be one cache line");
+static_assert(sizeof(DirectoryEntry) == ALIGNMENT, "Directory entry must be one cache line");
+static_assert(sizeof(RecordHeader) == ALIGNMENT, "Record header must be one cache line");
+
+size_t align_up(size_t value) {
+    return (value + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+}
+
+size_t padded_count(size_t n) {
+    return align_up(n * sizeof(double)) / sizeof(double);
+}
+
+}
+
+class MappedFile {
+public:
+    explicit MappedFile(const std::string& path) {
+#if defined(_WIN32)
+        std::ifstream in(path, std::ios::binary);
+        if (!in) {
+            throw std::runtime_error("Cannot open curve snapshot: " + path);
+        }
+        buffer_.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        data_ = buffer_.data();
+        size_ = buffer_.size();
+#else
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("Cannot open curve snapshot: " + path);
+        }
+
+        struct stat st;
+        if (::fstat(fd, &st) != 0 || st.st_size <= 0) {
+            ::close(fd);
+            throw std::runtime_error("Cannot stat curve snapshot: " + path);
+        }
+
+        size_ = static_cast<size_t>(st.st_size);
+        void* addr = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+
+        if (addr == MAP_FAILED) {
+            throw std::runtime_error("Cannot map curve snapshot: " + path);
+        }
+        data_ = static_cast<const char*>(addr);
+#endif
+    }
+
+    ~MappedFile() {
+#if !defined(_WIN32)
+        if (data_) {
+            ::munmap(const_cast<char*>(data_), size_);
+        }
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const char* data() const { return data_; }
+    size_t size() const { return size_; }
+
+private:
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+#if defined(_WIN32)
+    std::vector<char> buffer_;
+#endif
+};
+
+YieldCurve CurveRecordView::to_curve() const {
+    YieldCurve curve(compounding, interpolation);
+
+    for (size_t i = 0; i < num_points; ++i) {
+        curve.add_point(times[i], discount_factors[i]);
+    }
+
+    if (has_spline) {
+        CubicSpline spline;
+        spline.load(
+            std::vector<double>(times, times + num_points),
+            std::vector<double>(spline_a, spline_a + num_points),
+            std::vector<double>(spline_b, spline_b + num_points - 1),
+            std::vector<double>(spline_c, spline_c + num_points),
+            std::vector<double>(spline_d, spline_d + num_points - 1)
+        );
+        curve.set_spline(spline);
+    }
+
+    return curve;
+}
+
+void CurveSnapshotWriter::add(const std::string& name, const YieldCurve& curve) {
+    if (name.empty() || name.size() > MAX_NAME_LENGTH) {
+        throw std::invalid_argument("Curve name must be 1-47 characters");
+    }
+
+    if (curve.size() == 0) {
+        throw std::invalid_argument("Cannot snapshot an empty curve");
+    }
+
+    for (const auto& record : records_) {
+        if (record.name == name) {
+            throw std::invalid_argument("Duplicate curve name: " + name);
+        }
+    }
+
+    Record record;
+    record.name = name;
+    record.compounding = curve.compounding_type();
+    record.interpolation = curve.interpolation_type();
+    record.times = curve.times();
+    record.discount_factors = curve.discount_factors();
+
+    const CubicSpline* spline = curve.spline();
+    record.has_spline = spline != nullptr;
+    if (spline) {
+        record.spline_a = spline->coefficients_a();
+        record.spline_b = spline->coefficients_b();
+        record.spline_c = spline->coefficients_c();
+        record.spline_d = spline->coefficients_d();
+    }
+
+    records_.push_back(std::move(record));
+}
+
+void CurveSnapshotWriter::write(const std::string& path) const {
+    std::vector<DirectoryEntry> directory(records_.size());
+    std::vector<size_t> record_sizes(records_.size());
+
+    size_t offset = sizeof(SnapshotHeader) + align_up(records_.size() * sizeof(DirectoryEntry));
+
+    for (size_t r = 0; r < records_.size(); ++r) {
+        const Record& record = records_[r];
+        size_t arrays = record.has_spline ? 6 : 2;
+        record_sizes[r] = sizeof(RecordHeader) + arrays * padded_count(record.times.size()) * sizeof(double);
+
+        std::memset(&directory[r], 0, sizeof(DirectoryEntry));
+        std::memcpy(directory[r].name, record.name.data(), record.name.size());
+        directory[r].offset = offset;
+        directory[r].size = record_sizes[r];
+        offset += record_sizes[r];
+    }
+
+    std::vector<char> buffer(offset, 0);
+
+    SnapshotHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = FORMAT_VERSION;
+    header.endian_tag = ENDIAN_TAG;
+    header.curve_count = static_cast<uint32_t>(records_.size());
+    header.directory_offset = sizeof(SnapshotHeader);
+    header.file_size = offset;
+    std::memcpy(buffer.data(), &header, sizeof(header));
+
+    if (!directory.empty()) {
+        std::memcpy(buffer.data() + sizeof(SnapshotHeader), directory.data(),
+                    directory.size() * sizeof(DirectoryEntry));
+    }
+
+    for (size_t r = 0; r < records_.size(); ++r) {
+        const Record& record = records_[r];
+        char* base = buffer.data() + directory[r].offset;
+        size_t stride = padded_count(record.times.size());
+
+        RecordHeader rh;
+        std::memset(&rh, 0, sizeof(rh));
+        rh.num_points = static_cast<uint32_t>(record.times.size());
+        rh.array_stride = static_cast<uint32_t>(stride);
+        rh.compounding = static_cast<uint8_t>(record.compounding);
+        rh.interpolation = static_cast<uint8_t>(record.interpolation);
+        rh.has_spline = record.has_spline ? 1 : 0;
+        std::memcpy(base, &rh, sizeof(rh));
+
+        char* arrays = base + sizeof(RecordHeader);
+        auto put = [&](size_t slot, const std::vector<double>& values) {
+            if (!values.empty()) {
+                std::memcpy(arrays + slot * stride * sizeof(double), values.data(),
+                            values.size() * sizeof(double));
+            }
+        };
+
+        put(0, record.times);
+        put(1, record.discount_factors);
+        if (record.has_spline) {
+            put(2, record.spline_a);
+            put(3, record.spline_b);
+            put(4, record.spline_c);
+            put(5, record.spline_d);
+        }
+    }
+
+    std::string tmp_path = path + ".tmp";
+    {
+        std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            throw std::runtime_error("Cannot open snapshot for writing: " + path);
+        }
+        out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        if (!out) {
+            throw std::runtime_error("Failed writing curve snapshot: " + path);
+        }
+    }
+
+    if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+        std::remove(tmp_path.c_str());
+        throw std::runtime_error("Cannot replace curve snapshot: " + path);
+    }
+}
+
+CurveStore::CurveStore() = default;
+CurveStore::~CurveStore() = default;
+CurveStore::CurveStore(CurveStore&&) noexcept = default;
+CurveStore& CurveStore::operator=(CurveStore&&) noexcept = default;
+
+CurveStore CurveStore::open(const std::string& path) {
+    namespace fs = std::filesystem;
+
+    CurveStore store;
+
+    if (fs::is_directory(path)) {
+        std::vector<std::string> files;
+        for (const auto& entry : fs::directory_iterator(path)) {
+            if (entry.is_regular_file() && entry.path().extension() == FILE_EXTENSION) {
+                files.push_back(entry.path().string());
+            }
+        }
+        std::sort(files.begin(), files.end());
+
+        for (const auto& file : files) {
+            store.map_file(file);
+        }
+    } else {
+        store.map_file(path);
+    }
+
+    return store;
+}
+
+void CurveStore::map_file(const std::string& path) {
+    auto file = std::make_unique<MappedFile>(path);
+    const char* data = file->data();
+    size_t size = file->size();
+
+    if (size < sizeof(SnapshotHeader)) {
+        throw std::runtime_error("Truncated curve snapshot: " + path);
+    }
+
+    SnapshotHeader header;
+    std::memcpy(&header, data, sizeof(header));
+
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+        throw std::runtime_error("Not a curve snapshot: " + path);
+    }
+
+    if (header.endian_tag != ENDIAN_TAG) {
+        throw std::runtime_error("Curve snapshot has foreign byte order: " + path);
+    }
+
+    if (header.version == 0 || header.version > CurveSnapshotWriter::FORMAT_VERSION) {
+        throw std::runtime_error("Unsupported curve snapshot version: " + path);
+    }
+
+    if (header.file_size != size || header.directory_offset % ALIGNMENT != 0 ||
+        header.directory_offset > size ||
+        header.curve_count > (size - header.directory_offset) / sizeof(DirectoryEntry)) {
+        throw std::runtime_error("Corrupt curve snapshot: " + path);
+    }
+
+    const auto* directory = reinterpret_cast<const DirectoryEntry*>(data + header.directory_offset);
+
+    for (uint32_t r = 0; r < header.curve_count; ++r) {
+        const DirectoryEntry& entry = directory[r];
+        if (entry.offset % ALIGNMENT != 0 || entry.offset > size || entry.size > size - entry.offset ||
+            entry.size < sizeof(RecordHeader)) {
+            throw std::runtime_error("Corrupt curve snapshot: " + path);
+        }
+
+        const auto* rh = reinterpret_cast<const RecordHeader*>(data + entry.offset);
+        size_t arrays = rh->has_spline ? 6 : 2;
+        if (rh->num_points == 0 || rh->array_stride < rh->num_points ||
+            rh->compounding > static_cast<uint8_t>(CompoundingType::QUARTERLY) ||
+            rh->interpolation > static_cast<uint8_t>(InterpolationType::FLAT_FORWARD) ||
+            sizeof(RecordHeader) + arrays * rh->array_stride * sizeof(double) > entry.size) {
+            throw std::runtime_error("Corrupt curve snapshot: " + path);
+        }
+
+        const auto* values = reinterpret_cast<const double*>(data + entry.offset + sizeof(RecordHeader));
+
+        CurveRecordView view;
+        view.name.assign(entry.name, strnlen(entry.name, sizeof(entry.name)));
+        view.num_points = rh->num_points;
+        view.compounding = static_cast<CompoundingType>(rh->compounding);
+        view.interpolation = static_cast<InterpolationType>(rh->interpolation);
+        view.times = values;
+        view.discount_factors = values + rh->array_stride;
+        view.has_spline = rh->has_spline != 0;
+        if (view.has_spline) {
+            view.spline_a = values + 2 * rh->array_stride;
+            view.spline_b = values + 3 * rh->array_stride;
+            view.spline_c = values + 4 * rh->array_stride;
+            view.spline_d = values + 5 * rh->array_stride;
+        }
+
+        if (!index_.emplace(view.name, view).second) {
+            throw std::runtime_error("Duplicate curve name in store: " + view.name);
+        }
+    }
+
+    files_.push_back(std::move(file));
+}
+
+bool CurveStore::contains(const std::string& name) const {
+    return index_.count(name) > 0;
+}
+
+const CurveRecordView& CurveStore::view(const std::string& name) const {
+    auto it = index_.find(name);
+    if (it == index_.end()) {
+        throw std::out_of_range("Curve not found in store: " + name);
+    }
+    return it->second;
+}
+
+YieldCurve CurveStore::load(const std::string& name) const {
+    return view(name).to_curve();
+}
+
+std::vector<std::string> CurveStore::names() const {
+    std::vector<std::string> result;
+    result.reserve(index_.size());
+    for (const auto& entry : index_) {
+        result.push_back(entry.first);
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+}
@@ -0,0 +1,126 @@
+#include "date.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <stdexcept>
+
+namespace yield_curve {
+
+namespace {
+
+int32_t days_from_civil(int year, unsigned month, unsigned day) {
+    year -= month <= 2;
+    int era = (year >= 0 ? year : year - 399) / 400;
+    unsigned yoe = static_cast<unsigned>(year - era * 400);
+    unsigned doy = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + static_cast<int32_t>(doe) - 719468;
+}
+
+}
+
+Date::Date(int year, unsigned month, unsigned day) {
+    if (month < 1 || month > 12) {
+        throw std::invalid_argument("Month must be between 1 and 12");
+    }
+    
+    if (day < 1 || day > days_in_month(year, month)) {
+        throw std::invalid_argument("Day out of range for month");
+    }
+    
+    serial_ = days_from_civil(year, month, day);
+}
+
+Date Date::from_serial(int32_t serial) {
+    Date date;
+    date.serial_ = serial;
+    return date;
+}
+
+void Date::to_civil(int& year, unsigned& month, unsigned& day) const {
+    int32_t z = serial_ + 719468;
+    int era = (z >= 0 ? z : z - 146096) / 146097;
+    unsigned doe = static_cast<unsigned>(z - era * 146097);
+    unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    unsigned mp = (5 * doy + 2) / 153;
+    
+    day = doy - (153 * mp + 2) / 5 + 1;
+    month = mp < 10 ? mp + 3 : mp - 9;
+    year = static_cast<int>(yoe) + era * 400 + (month <= 2);
+}
+
+int Date::year() const {
+    int y;
+    unsigned m, d;
+    to_civil(y, m, d);
+    return y;
+}
+
+unsigned Date::month() const {
+    int y;
+    unsigned m, d;
+    to_civil(y, m, d);
+    return m;
+}
+
+unsigned Date::day() const {
+    int y;
+    unsigned m, d;
+    to_civil(y, m, d);
+    return d;
+}
+
+Weekday Date::weekday() const {
+    int index = ((serial_ + 3) % 7 + 7) % 7;
+    return static_cast<Weekday>(index);
+}
+
+Date Date::add_months(int months, bool end_of_month) const {
+    int y;
+    unsigned m, d;
+    to_civil(y, m, d);
+    
+    int total = y * 12 + static_cast<int>(m) - 1 + months;
+    int new_year = (total >= 0 ? total : total - 11) / 12;
+    unsigned new_month = static_cast<unsigned>(total - new_year * 12) + 1;
+    unsigned last_day = days_in_month(new_year, new_month);
+    
+    if (end_of_month && d == days_in_month(y, m)) {
+        return Date(new_year, new_month, last_day);
+    }
+    
+    return Date(new_year, new_month, std::min(d, last_day));
+}
+
+bool Date::is_end_of_month() const {
+    int y;
+    unsigned m, d;
+    to_civil(y, m, d);
+    return d == days_in_month(y, m);
+}
+
+std::string Date::to_string() const {
+    int y;
+    unsigned m, d;
+    to_civil(y, m, d);
+    
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%04d-%02u-%02u", y, m, d);
+    return buffer;
+}
+
+bool Date::is_leap_year(int year) {
+    return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+unsigned Date::days_in_month(int year, unsigned month) {
+    static const unsigned days[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    
+    if (month < 1 || month > 12) {
+        throw std::invalid_argument("Month must be between 1 and 12");
+    }
+    
+    return (month == 2 && is_leap_year(year)) ? 29 : days[month - 1];
+}
+
+}
@@ -0,0 +1,319 @@
+#include "exposure_engine.hpp"
+#include "parallel.hpp"
+#include "random_utils.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace yield_curve {
+
+ExposureEngine::ExposureEngine(const YieldCurve& curve, double mean_reversion, double volatility)
+    : curve_(curve), a_(mean_reversion), sigma_(volatility) {
+    if (mean_reversion <= 0) {
+        throw std::invalid_argument("Mean reversion must be positive");
+    }
+
+    if (volatility < 0) {
+        throw std::invalid_argument("Volatility must be non-negative");
+    }
+}
+
+size_t ExposureEngine::intern_time(double time) {
+    auto it = std::lower_bound(flow_times_.begin(), flow_times_.end(), time - 1e-10);
+    if (it != flow_times_.end() && std::abs(*it - time) <= 1e-10) {
+        return static_cast<size_t>(it - flow_times_.begin());
+    }
+
+    size_t index = static_cast<size_t>(it - flow_times_.begin());
+    flow_times_.insert(it, time);
+    for (auto& flow : flows_) {
+        if (flow.time_index >= index) {
+            ++flow.time_index;
+        }
+    }
+    return index;
+}
+
+void ExposureEngine::add_flow(double pay_time, double amount, double live_from, double live_until) {
+    if (pay_time < 0) {
+        throw std::invalid_argument("Cash flow time must be non-negative");
+    }
+
+    flows_.push_back({intern_time(pay_time), amount, live_from, live_until});
+}
+
+void ExposureEngine::add_cash_flows(const std::vector<double>& times, const std::vector<double>& amounts) {
+    if (times.size() != amounts.size()) {
+        throw std::invalid_argument("Times and amounts size mismatch");
+    }
+
+    double lowest = -std::numeric_limits<double>::infinity();
+    for (size_t i = 0; i < times.size(); ++i) {
+        add_flow(times[i], amounts[i], lowest, times[i]);
+    }
+}
+
+void ExposureEngine::add_bond(const BondData& bond, double quantity) {
+    std::vector<double> amounts = bond.get_cash_flows();
+    for (double& amount : amounts) {
+        amount *= quantity;
+    }
+    add_cash_flows(bond.get_payment_times(), amounts);
+}
+
+void ExposureEngine::add_swap(const SwapData& swap) {
+    if (swap.start < 0 || swap.maturity <= swap.start) {
+        throw std::invalid_argument("Swap maturity must be after start");
+    }
+
+    if (swap.fixed_frequency <= 0 || swap.float_frequency <= 0) {
+        throw std::invalid_argument("Swap payment frequencies must be positive");
+    }
+
+    double sign = (swap.direction == SwapDirection::PAYER) ? 1.0 : -1.0;
+    double notional = sign * swap.notional;
+    double lowest = -std::numeric_limits<double>::infinity();
+
+    double prev = swap.start;
+    for (double t : swap.get_fixed_payment_times()) {
+        add_flow(t, -notional * swap.fixed_rate * (t - prev), lowest, t);
+        prev = t;
+    }
+
+    prev = swap.start;
+    for (double t : swap.get_float_payment_times()) {
+        double tau = t - prev;
+
+        add_flow(prev, notional, lowest, prev);
+        add_flow(t, -notional, lowest, prev);
+        add_flow(t, notional * swap.float_spread * tau, lowest, prev);
+        resets_.push_back({prev, t, notional, tau, swap.float_spread});
+        prev = t;
+    }
+}
+
+double ExposureEngine::b_factor(double tau) const {
+    return -std::expm1(-a_ * tau) / a_;
+}
+
+ExposureProfile ExposureEngine::simulate(
+    const std::vector<double>& exposure_times,
+    size_t num_paths,
+    double pfe_quantile,
+    uint64_t seed,
+    unsigned num_threads
+) const {
+    if (num_paths == 0) {
+        throw std::invalid_argument("Path count must be positive");
+    }
+
+    if (pfe_quantile <= 0 || pfe_quantile >= 1) {
+        throw std::invalid_argument("PFE quantile must be in (0, 1)");
+    }
+
+    for (size_t i = 0; i < exposure_times.size(); ++i) {
+        if (exposure_times[i] < 0 || (i > 0 && exposure_times[i] <= exposure_times[i - 1])) {
+            throw std::invalid_argument("Exposure times must be non-negative and strictly increasing");
+        }
+    }
+
+    std::vector<double> initial_dfs = curve_.get_discount_factors(flow_times_);
+
+    size_t num_blocks = (num_paths + BLOCK_PATHS - 1) / BLOCK_PATHS;
+    std::vector<std::mt19937_64> generators;
+    generators.reserve(num_blocks);
+    for (size_t b = 0; b < num_blocks; ++b) {
+        generators.emplace_back(detail::splitmix64(seed + b));
+    }
+
+    std::vector<double> event_times = exposure_times;
+    if (!exposure_times.empty()) {
+        for (const auto& reset : resets_) {
+            if (reset.reset_time <= exposure_times.back()) {
+                event_times.push_back(reset.reset_time);
+            }
+        }
+    }
+    std::sort(event_times.begin(), event_times.end());
+    event_times.erase(std::unique(event_times.begin(), event_times.end()), event_times.end());
+
+    std::vector<double> pay_times;
+    pay_times.reserve(resets_.size());
+    for (const auto& reset : resets_) {
+        pay_times.push_back(reset.pay_time);
+    }
+    std::sort(pay_times.begin(), pay_times.end());
+    pay_times.erase(std::unique(pay_times.begin(), pay_times.end(),
+                                [](double a, double b) { return b - a <= 1e-10; }),
+                    pay_times.end());
+
+    std::vector<size_t> reset_slots;
+    reset_slots.reserve(resets_.size());
+    for (const auto& reset : resets_) {
+        auto it = std::lower_bound(pay_times.begin(), pay_times.end(), reset.pay_time - 1e-10);
+        reset_slots.push_back(static_cast<size_t>(it - pay_times.begin()));
+    }
+
+    std::vector<double> x(num_paths, 0.0);
+    std::vector<double> values(num_paths, 0.0);
+    std::vector<double> normals(num_paths, 0.0);
+    std::vector<double> exposures(num_paths, 0.0);
+    std::vector<std::vector<double>> fixed_amounts(pay_times.size());
+    std::vector<std::vector<double>> spare_amounts;
+    std::vector<double> aggregated(flow_times_.size(), 0.0);
+    std::vector<double> coefficients;
+    std::vector<double> sensitivities;
+    std::vector<double*> open_amounts;
+    std::vector<double> open_coefficients;
+    std::vector<double> open_sensitivities;
+    std::vector<size_t> fixings;
+    std::vector<size_t> fixing_slots;
+    coefficients.reserve(flow_times_.size());
+    sensitivities.reserve(flow_times_.size());
+
+    ExposureProfile profile;
+    profile.times = exposure_times;
+
+    size_t rank = static_cast<size_t>(std::ceil(pfe_quantile * num_paths)) - 1;
+    size_t next_exposure = 0;
+    size_t first_unpaid = 0;
+    double prev_time = 0.0;
+
+    for (double t : event_times) {
+        double dt = t - prev_time;
+        double decay = std::exp(-a_ * dt);
+        double shock = sigma_ * std::sqrt(-std::expm1(-2.0 * a_ * dt) / (2.0 * a_));
+        double convexity = sigma_ * sigma_ / (4.0 * a_) * -std::expm1(-2.0 * a_ * t);
+        double df_t = curve_.get_discount_factor(t);
+        bool is_exposure = next_exposure < exposure_times.size() && exposure_times[next_exposure] == t;
+
+        for (; first_unpaid < pay_times.size() && pay_times[first_unpaid] <= t; ++first_unpaid) {
+            if (!fixed_amounts[first_unpaid].empty()) {
+                spare_amounts.emplace_back();
+                spare_amounts.back().swap(fixed_amounts[first_unpaid]);
+            }
+        }
+
+        fixings.clear();
+        for (size_t r = 0; r < resets_.size(); ++r) {
+            if (resets_[r].reset_time != t || resets_[r].pay_time <= t) {
+                continue;
+            }
+            std::vector<double>& amounts = fixed_amounts[reset_slots[r]];
+            if (amounts.empty() && !spare_amounts.empty()) {
+                amounts.swap(spare_amounts.back());
+                spare_amounts.pop_back();
+                std::fill(amounts.begin(), amounts.end(), 0.0);
+            } else if (amounts.empty()) {
+                amounts.assign(num_paths, 0.0);
+            }
+            fixings.push_back(r);
+        }
+
+        open_amounts.clear();
+        open_coefficients.clear();
+        open_sensitivities.clear();
+        fixing_slots.assign(fixings.size(), 0);
+        for (size_t i = first_unpaid; i < pay_times.size(); ++i) {
+            if (fixed_amounts[i].empty()) {
+                continue;
+            }
+            for (size_t j = 0; j < fixings.size(); ++j) {
+                if (reset_slots[fixings[j]] == i) {
+                    fixing_slots[j] = open_amounts.size();
+                }
+            }
+            double b = b_factor(pay_times[i] - t);
+            open_amounts.push_back(fixed_amounts[i].data());
+            open_coefficients.push_back(curve_.get_discount_factor(pay_times[i]) / df_t *
+                                        std::exp(-convexity * b * b));
+            open_sensitivities.push_back(b);
+        }
+
+        coefficients.clear();
+        sensitivities.clear();
+        if (is_exposure) {
+            std::fill(aggregated.begin(), aggregated.end(), 0.0);
+            for (const auto& flow : flows_) {
+                if (flow.live_from <= t && t < flow.live_until) {
+                    aggregated[flow.time_index] += flow.amount;
+                }
+            }
+
+            for (size_t k = 0; k < flow_times_.size(); ++k) {
+                if (aggregated[k] == 0.0 || flow_times_[k] < t) {
+                    continue;
+                }
+                double b = b_factor(flow_times_[k] - t);
+                coefficients.push_back(aggregated[k] * initial_dfs[k] / df_t * std::exp(-convexity * b * b));
+                sensitivities.push_back(b);
+            }
+        }
+
+        auto worker = [&](size_t block_begin, size_t block_end) {
+            for (size_t block = block_begin; block < block_end; ++block) {
+                size_t begin = block * BLOCK_PATHS;
+                size_t end = std::min(num_paths, begin + BLOCK_PATHS);
+
+                if (dt > 0) {
+                    detail::fill_normals(generators[block], &normals[begin], end - begin);
+                    for (size_t p = begin; p < end; ++p) {
+                        x[p] = x[p] * decay + shock * normals[p];
+                    }
+                }
+
+                for (size_t j = 0; j < fixings.size(); ++j) {
+                    const Reset& reset = resets_[fixings[j]];
+                    size_t slot = fixing_slots[j];
+                    double* amounts = open_amounts[slot];
+                    for (size_t p = begin; p < end; ++p) {
+                        double bond = open_coefficients[slot] * std::exp(-open_sensitivities[slot] * x[p]);
+                        amounts[p] += reset.notional * (1.0 / bond - 1.0 + reset.spread * reset.accrual);
+                    }
+                }
+
+                if (!is_exposure) {
+                    continue;
+                }
+
+                for (size_t p = begin; p < end; ++p) {
+                    double value = 0.0;
+                    for (size_t k = 0; k < coefficients.size(); ++k) {
+                        value += coefficients[k] * std::exp(-sensitivities[k] * x[p]);
+                    }
+                    for (size_t j = 0; j < open_amounts.size(); ++j) {
+                        value += open_amounts[j][p] * open_coefficients[j] * std::exp(-open_sensitivities[j] * x[p]);
+                    }
+                    values[p] = value;
+                }
+            }
+        };
+
+        detail::parallel_for(num_blocks, num_threads, worker);
+
+        prev_time = t;
+        if (!is_exposure) {
+            continue;
+        }
+
+        double sum_value = 0.0;
+        double sum_exposure = 0.0;
+        for (size_t p = 0; p < num_paths; ++p) {
+            sum_value += values[p];
+            exposures[p] = std::max(values[p], 0.0);
+            sum_exposure += exposures[p];
+        }
+
+        std::nth_element(exposures.begin(), exposures.begin() + rank, exposures.end());
+
+        profile.expected_value.push_back(sum_value / num_paths);
+        profile.expected_exposure.push_back(sum_exposure / num_paths);
+        profile.potential_future_exposure.push_back(exposures[rank]);
+        ++next_exposure;
+    }
+
+    return profile;
+}
+
+}
@@ -1,4 +1,6 @@
 #include "forward_curve.hpp"
+#include <cmath>
+#include <stdexcept>
 
 namespace yield_curve {
 
@@ -18,12 +20,40 @@ std::vector<double> ForwardCurve::get_forward_curve(
 ) const {
     std::vector<double> forward_rates;
     
+    if (tenors.size() < 2) {
+        return forward_rates;
+    }
+    
+    for (size_t i = 0; i < tenors.size() - 1; ++i) {
+        if (tenors[i] >= tenors[i + 1]) {
+            throw std::invalid_argument("Tenors must be strictly increasing");
+        }
+    }
+    
+    std::vector<double> log_dfs = yield_curve_.get_discount_factors(tenors);
+    for (double& df : log_dfs) {
+        df = std::log(df);
+    }
+    
+    forward_rates.reserve(tenors.size() - 1);
     for (size_t i = 0; i < tenors.size() - 1; ++i) {
-        double fwd = get_forward_rate(tenors[i], tenors[i + 1]);
-        forward_rates.push_back(fwd);
+        forward_rates.push_back(-(log_dfs[i + 1] - log_dfs[i]) / (tenors[i + 1] - tenors[i]));
     }
     
     return forward_rates;
 }
 
+std::vector<double> ForwardCurve::get_instantaneous_forward_curve(
+    const std::vector<double>& tenors
+) const {
+    std::vector<double> forwards;
+    forwards.reserve(tenors.size());
+    
+    for (double t : tenors) {
+        forwards.push_back(yield_curve_.get_instantaneous_forward(t));
+    }
+    
+    return forwards;
+}
+
 }
@@ -0,0 +1,62 @@
+#include "hazard_curve.hpp"
+#include "discount_factor.hpp"
+#include <stdexcept>
+
+namespace yield_curve {
+
+HazardCurve::HazardCurve() : HazardCurve(InterpolationType::FLAT_FORWARD) {}
+
+HazardCurve::HazardCurve(InterpolationType interp_type)
+    : times_{0.0}, survival_{1.0}, interpolation_type_(interp_type),
+      interpolator_(create_interpolator(interp_type)) {}
+
+void HazardCurve::add_point(double time, double survival_probability) {
+    if (time <= times_.back()) {
+        throw std::invalid_argument("Hazard curve pillars must be strictly increasing");
+    }
+    
+    if (!DiscountFactor::is_valid(survival_probability)) {
+        throw std::invalid_argument("Invalid survival probability");
+    }
+    
+    if (survival_probability > survival_.back()) {
+        throw std::invalid_argument("Survival probability must be non-increasing");
+    }
+    
+    times_.push_back(time);
+    survival_.push_back(survival_probability);
+}
+
+double HazardCurve::get_survival_probability(double time) const {
+    if (time < 0) {
+        throw std::invalid_argument("Time must be non-negative");
+    }
+    
+    if (times_.size() == 1) {
+        return 1.0;
+    }
+    
+    return interpolator_->interpolate(time, times_, survival_);
+}
+
+double HazardCurve::get_default_probability(double t1, double t2) const {
+    if (t1 >= t2) {
+        throw std::invalid_argument("t1 must be less than t2");
+    }
+    
+    return get_survival_probability(t1) - get_survival_probability(t2);
+}
+
+double HazardCurve::get_hazard_rate(double time) const {
+    if (time < 0) {
+        throw std::invalid_argument("Time must be non-negative");
+    }
+    
+    if (times_.size() == 1) {
+        return 0.0;
+    }
+    
+    return interpolator_->instantaneous_forward(time, times_, survival_);
+}
+
+}
@@ -0,0 +1,216 @@
+#include "hull_white.hpp"
+#include "parallel.hpp"
+#include "random_utils.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace yield_curve {
+
+DiscountFactorAccumulator::DiscountFactorAccumulator(size_t num_steps)
+    : sum_(num_steps + 1, 0.0), sum_sq_(num_steps + 1, 0.0) {}
+
+std::unique_ptr<PathAccumulator> DiscountFactorAccumulator::clone() const {
+    return std::make_unique<DiscountFactorAccumulator>(sum_.size() - 1);
+}
+
+void DiscountFactorAccumulator::observe(
+    size_t step,
+    double,
+    const double*,
+    const double* discount_factors,
+    size_t num_paths
+) {
+    double sum = 0.0;
+    double sum_sq = 0.0;
+    for (size_t p = 0; p < num_paths; ++p) {
+        sum += discount_factors[p];
+        sum_sq += discount_factors[p] * discount_factors[p];
+    }
+
+    sum_[step] += sum;
+    sum_sq_[step] += sum_sq;
+
+    if (step == sum_.size() - 1) {
+        count_ += num_paths;
+    }
+}
+
+void DiscountFactorAccumulator::merge(const PathAccumulator& other) {
+    const auto& rhs = dynamic_cast<const DiscountFactorAccumulator&>(other);
+    if (rhs.sum_.size() != sum_.size()) {
+        throw std::invalid_argument("Accumulator step count mismatch");
+    }
+
+    for (size_t i = 0; i < sum_.size(); ++i) {
+        sum_[i] += rhs.sum_[i];
+        sum_sq_[i] += rhs.sum_sq_[i];
+    }
+    count_ += rhs.count_;
+}
+
+double DiscountFactorAccumulator::mean(size_t step) const {
+    if (step == 0) {
+        return 1.0;
+    }
+
+    if (count_ == 0) {
+        throw std::runtime_error("No paths accumulated");
+    }
+
+    return sum_.at(step) / count_;
+}
+
+double DiscountFactorAccumulator::standard_error(size_t step) const {
+    if (step == 0 || count_ < 2) {
+        return 0.0;
+    }
+
+    double m = mean(step);
+    double variance = (sum_sq_.at(step) / count_ - m * m) * count_ / (count_ - 1);
+    return std::sqrt(std::max(variance, 0.0) / count_);
+}
+
+HullWhiteSimulator::HullWhiteSimulator(
+    const YieldCurve& curve,
+    double mean_reversion,
+    double volatility,
+    double horizon,
+    size_t num_steps
+) : curve_(curve), a_(mean_reversion), sigma_(volatility) {
+    if (mean_reversion <= 0) {
+        throw std::invalid_argument("Mean reversion must be positive");
+    }
+
+    if (volatility < 0) {
+        throw std::invalid_argument("Volatility must be non-negative");
+    }
+
+    if (horizon <= 0 || num_steps == 0) {
+        throw std::invalid_argument("Horizon and step count must be positive");
+    }
+
+    times_.resize(num_steps + 1);
+    for (size_t i = 0; i <= num_steps; ++i) {
+        times_[i] = horizon * static_cast<double>(i) / num_steps;
+    }
+
+    calibrate_drift();
+}
+
+double HullWhiteSimulator::theta(double t) const {
+    constexpr double h = 1e-4;
+
+    double f = curve_.get_instantaneous_forward(t);
+    double f_up = curve_.get_instantaneous_forward(t + h);
+    double f_down = curve_.get_instantaneous_forward(std::max(t - h, 0.0));
+    double df_dt = (f_up - f_down) / (t + h - std::max(t - h, 0.0));
+
+    return df_dt + a_ * f + sigma_ * sigma_ / (2.0 * a_) * (1.0 - std::exp(-2.0 * a_ * t));
+}
+
+void HullWhiteSimulator::calibrate_drift() {
+    size_t n = num_steps();
+    alpha_.resize(n);
+    decay_.resize(n);
+    shock_std_.resize(n);
+
+    double var_x = 0.0;
+    double cov_ix = 0.0;
+    double var_i = 0.0;
+    double log_df_prev = 0.0;
+
+    for (size_t j = 0; j < n; ++j) {
+        double dt = times_[j + 1] - times_[j];
+        double decay = std::exp(-a_ * dt);
+        double shock_var = sigma_ * sigma_ * (1.0 - decay * decay) / (2.0 * a_);
+
+        double var_i_next = var_i + 2.0 * dt * cov_ix + dt * dt * var_x;
+        cov_ix = decay * (cov_ix + dt * var_x);
+        var_x = decay * decay * var_x + shock_var;
+
+        double log_df = std::log(curve_.get_discount_factor(times_[j + 1]));
+        alpha_[j] = (log_df_prev - log_df + 0.5 * (var_i_next - var_i)) / dt;
+        decay_[j] = decay;
+        shock_std_[j] = std::sqrt(shock_var);
+
+        var_i = var_i_next;
+        log_df_prev = log_df;
+    }
+}
+
+void HullWhiteSimulator::simulate_block(
+    size_t block,
+    size_t paths,
+    uint64_t seed,
+    PathAccumulator& accumulator,
+    Workspace& ws
+) const {
+    std::mt19937_64 rng(detail::splitmix64(seed ^ detail::splitmix64(block)));
+
+    std::fill(ws.x.begin(), ws.x.begin() + paths, 0.0);
+    std::fill(ws.integral.begin(), ws.integral.begin() + paths, 0.0);
+
+    double* x = ws.x.data();
+    double* integral = ws.integral.data();
+    double* rates = ws.rates.data();
+    double* dfs = ws.discount_factors.data();
+    const double* z = ws.normals.data();
+
+    for (size_t j = 0; j < num_steps(); ++j) {
+        double dt = times_[j + 1] - times_[j];
+        double alpha = alpha_[j];
+        double decay = decay_[j];
+        double shock = shock_std_[j];
+
+        detail::fill_normals(rng, ws.normals.data(), paths);
+
+        for (size_t p = 0; p < paths; ++p) {
+            rates[p] = alpha + x[p];
+            integral[p] += rates[p] * dt;
+            dfs[p] = std::exp(-integral[p]);
+            x[p] = decay * x[p] + shock * z[p];
+        }
+
+        accumulator.observe(j + 1, times_[j + 1], rates, dfs, paths);
+    }
+}
+
+void HullWhiteSimulator::simulate(
+    size_t num_paths,
+    PathAccumulator& accumulator,
+    uint64_t seed,
+    unsigned num_threads
+) const {
+    if (num_paths == 0) {
+        throw std::invalid_argument("Number of paths must be positive");
+    }
+
+    size_t num_blocks = (num_paths + BLOCK_PATHS - 1) / BLOCK_PATHS;
+
+    std::vector<std::unique_ptr<PathAccumulator>> partials(num_blocks);
+
+    detail::parallel_for(num_blocks, num_threads, [&](size_t first, size_t last) {
+        Workspace ws;
+        ws.x.resize(BLOCK_PATHS);
+        ws.integral.resize(BLOCK_PATHS);
+        ws.rates.resize(BLOCK_PATHS);
+        ws.discount_factors.resize(BLOCK_PATHS);
+        ws.normals.resize(BLOCK_PATHS);
+
+        std::unique_ptr<PathAccumulator> partial = accumulator.clone();
+        for (size_t b = first; b < last; ++b) {
+            size_t paths = std::min(BLOCK_PATHS, num_paths - b * BLOCK_PATHS);
+            simulate_block(b, paths, seed, *partial, ws);
+        }
+        partials[first] = std::move(partial);
+    });
+
+    for (const auto& partial : partials) {
+        if (partial) {
+            accumulator.merge(*partial);
+        }
+    }
+}
+
+}
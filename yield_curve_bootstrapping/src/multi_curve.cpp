@@ -0,0 +1,405 @@
+#include "multi_curve.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace yield_curve {
+
+RateInstrument RateInstrument::deposit(size_t curve, double maturity, double rate) {
+    return {RateInstrumentType::DEPOSIT, curve, curve, 0.0, maturity, rate, 0, 0, 0.0};
+}
+
+RateInstrument RateInstrument::fra(size_t curve, double start, double end, double rate) {
+    return {RateInstrumentType::FRA, curve, curve, start, end, rate, 0, 0, 0.0};
+}
+
+RateInstrument RateInstrument::future(size_t curve, double start, double end, double price,
+                                      double convexity_adjustment) {
+    return {RateInstrumentType::FUTURE, curve, curve, start, end, price, 0, 0, convexity_adjustment};
+}
+
+RateInstrument RateInstrument::swap(size_t discount_curve, size_t projection_curve, double maturity,
+                                    double rate, int fixed_frequency, int float_frequency) {
+    return {RateInstrumentType::SWAP, discount_curve, projection_curve, 0.0, maturity, rate,
+            fixed_frequency, float_frequency, 0.0};
+}
+
+RateInstrument RateInstrument::ois_swap(size_t curve, double maturity, double rate, int frequency) {
+    return swap(curve, curve, maturity, rate, frequency, frequency);
+}
+
+double RateInstrument::implied_rate() const {
+    if (type == RateInstrumentType::FUTURE) {
+        return (100.0 - quote) / 100.0 - convexity_adjustment;
+    }
+    return quote;
+}
+
+MultiCurveBuilder::MultiCurveBuilder(CompoundingType type) : compounding_type_(type) {}
+
+size_t MultiCurveBuilder::add_curve(const std::string& name) {
+    for (const auto& layout : curves_) {
+        if (layout.name == name) {
+            throw std::invalid_argument("Duplicate curve name: " + name);
+        }
+    }
+    
+    curves_.push_back({name, 0, {}});
+    compiled_ = false;
+    solved_ = false;
+    return curves_.size() - 1;
+}
+
+void MultiCurveBuilder::add_instrument(const RateInstrument& instrument) {
+    validate_instrument(instrument);
+    instruments_.push_back(instrument);
+    compiled_ = false;
+    solved_ = false;
+}
+
+void MultiCurveBuilder::validate_instrument(const RateInstrument& instrument) const {
+    if (instrument.discount_curve >= curves_.size() || instrument.projection_curve >= curves_.size()) {
+        throw std::out_of_range("Curve index out of range");
+    }
+    
+    if (instrument.start < 0 || instrument.end <= instrument.start) {
+        throw std::invalid_argument("Instrument end must be after start");
+    }
+    
+    if (instrument.type == RateInstrumentType::SWAP &&
+        (instrument.fixed_frequency <= 0 || instrument.float_frequency <= 0)) {
+        throw std::invalid_argument("Swap payment frequencies must be positive");
+    }
+}
+
+void MultiCurveBuilder::build() {
+    if (instruments_.empty()) {
+        throw std::runtime_error("No instruments to build from");
+    }
+    
+    if (!compiled_) {
+        compile();
+    }
+    
+    solved_ = false;
+    solve();
+}
+
+void MultiCurveBuilder::update_quotes(const std::vector<double>& quotes) {
+    if (!solved_) {
+        throw std::runtime_error("Curves must be built before updating quotes");
+    }
+    
+    if (quotes.size() != instruments_.size()) {
+        throw std::invalid_argument("Quote count must match instrument count");
+    }
+    
+    for (size_t i = 0; i < quotes.size(); ++i) {
+        instruments_[i].quote = quotes[i];
+    }
+    
+    solve();
+}
+
+void MultiCurveBuilder::compile() {
+    for (auto& layout : curves_) {
+        layout.pillars.clear();
+    }
+    
+    for (const auto& instrument : instruments_) {
+        curves_[instrument.projection_curve].pillars.push_back(instrument.end);
+    }
+    
+    size_t offset = 0;
+    for (auto& layout : curves_) {
+        if (layout.pillars.empty()) {
+            throw std::runtime_error("Curve has no calibrating instruments: " + layout.name);
+        }
+        
+        std::sort(layout.pillars.begin(), layout.pillars.end());
+        for (size_t i = 1; i < layout.pillars.size(); ++i) {
+            if (layout.pillars[i] - layout.pillars[i - 1] < 1e-10) {
+                throw std::invalid_argument("Duplicate pillar on curve: " + layout.name);
+            }
+        }
+        
+        layout.offset = offset;
+        offset += layout.pillars.size();
+    }
+    
+    nodes_.clear();
+    node_signs_.clear();
+    terms_.clear();
+    kernels_.clear();
+    
+    for (const auto& instrument : instruments_) {
+        compile_instrument(instrument);
+    }
+    
+    state_.assign(offset, 0.0);
+    residuals_.assign(offset, 0.0);
+    jacobian_.assign(offset * offset, 0.0);
+    compiled_ = true;
+}
+
+MultiCurveBuilder::Node MultiCurveBuilder::make_node(size_t curve, double time) const {
+    if (time <= 0) {
+        return {-1, -1, 0.0, 0.0};
+    }
+    
+    const CurveLayout& layout = curves_[curve];
+    const std::vector<double>& pillars = layout.pillars;
+    
+    size_t g = std::upper_bound(pillars.begin(), pillars.end(), time) - pillars.begin();
+    g = std::min(g, pillars.size() - 1);
+    
+    double t1 = (g == 0) ? 0.0 : pillars[g - 1];
+    double t2 = pillars[g];
+    double w = (time - t1) / (t2 - t1);
+    
+    int lo = (g == 0) ? -1 : static_cast<int>(layout.offset + g - 1);
+    int hi = static_cast<int>(layout.offset + g);
+    
+    return {lo, hi, 1.0 - w, w};
+}
+
+void MultiCurveBuilder::begin_term(double base, double slope) {
+    terms_.push_back({nodes_.size(), 0, base, slope});
+    kernels_.back().num_terms++;
+}
+
+void MultiCurveBuilder::add_node(size_t curve, double time, double sign) {
+    nodes_.push_back(make_node(curve, time));
+    node_signs_.push_back(sign);
+    terms_.back().num_nodes++;
+}
+
+void MultiCurveBuilder::compile_instrument(const RateInstrument& instrument) {
+    size_t d = instrument.discount_curve;
+    size_t p = instrument.projection_curve;
+    
+    if (instrument.type != RateInstrumentType::SWAP) {
+        kernels_.push_back({terms_.size(), 0, -1.0, -(instrument.end - instrument.start)});
+        begin_term(1.0, 0.0);
+        add_node(p, instrument.start, 1.0);
+        add_node(p, instrument.end, -1.0);
+        return;
+    }
+    
+    kernels_.push_back({terms_.size(), 0, 0.0, 0.0});
+    
+    double prev = instrument.start;
+    for (double t : payment_schedule(instrument.start, instrument.end, instrument.fixed_frequency)) {
+        begin_term(0.0, -(t - prev));
+        add_node(d, t, 1.0);
+        prev = t;
+    }
+    
+    prev = instrument.start;
+    for (double t : payment_schedule(instrument.start, instrument.end, instrument.float_frequency)) {
+        begin_term(1.0, 0.0);
+        add_node(d, t, 1.0);
+        add_node(p, prev, 1.0);
+        add_node(p, t, -1.0);
+        begin_term(-1.0, 0.0);
+        add_node(d, t, 1.0);
+        prev = t;
+    }
+}
+
+double MultiCurveBuilder::node_log_df(const Node& node) const {
+    double value = 0.0;
+    if (node.lo >= 0) {
+        value += node.w_lo * state_[node.lo];
+    }
+    if (node.hi >= 0) {
+        value += node.w_hi * state_[node.hi];
+    }
+    return value;
+}
+
+double MultiCurveBuilder::evaluate_kernel(size_t index, double* jacobian_row) const {
+    const Kernel& kernel = kernels_[index];
+    double rate = instruments_[index].implied_rate();
+    double value = kernel.base + kernel.slope * rate;
+    
+    for (size_t t = kernel.first_term; t < kernel.first_term + kernel.num_terms; ++t) {
+        const Term& term = terms_[t];
+        double coefficient = term.base + term.slope * rate;
+        if (coefficient == 0.0) {
+            continue;
+        }
+        
+        size_t end = term.first_node + term.num_nodes;
+        double log_df = 0.0;
+        for (size_t n = term.first_node; n < end; ++n) {
+            log_df += node_signs_[n] * node_log_df(nodes_[n]);
+        }
+        
+        double contribution = coefficient * std::exp(log_df);
+        value += contribution;
+        
+        if (jacobian_row) {
+            for (size_t n = term.first_node; n < end; ++n) {
+                const Node& node = nodes_[n];
+                double scale = contribution * node_signs_[n];
+                if (node.lo >= 0) {
+                    jacobian_row[node.lo] += scale * node.w_lo;
+                }
+                if (node.hi >= 0) {
+                    jacobian_row[node.hi] += scale * node.w_hi;
+                }
+            }
+        }
+    }
+    
+    return value;
+}
+
+void MultiCurveBuilder::solve() {
+    size_t n = state_.size();
+    
+    if (!solved_) {
+        for (const auto& layout : curves_) {
+            for (size_t i = 0; i < layout.pillars.size(); ++i) {
+                state_[layout.offset + i] = -INITIAL_RATE * layout.pillars[i];
+            }
+        }
+    }
+    
+    solved_ = false;
+    iterations_ = 0;
+    
+    for (int iter = 0; iter <= MAX_ITERATIONS; ++iter) {
+        std::fill(jacobian_.begin(), jacobian_.end(), 0.0);
+        
+        double max_residual = 0.0;
+        for (size_t k = 0; k < n; ++k) {
+            residuals_[k] = -evaluate_kernel(k, &jacobian_[k * n]);
+            max_residual = std::max(max_residual, std::abs(residuals_[k]));
+        }
+        
+        if (max_residual < TOLERANCE) {
+            solved_ = true;
+            return;
+        }
+        
+        if (iter == MAX_ITERATIONS) {
+            break;
+        }
+        
+        solve_linear_system(residuals_);
+        
+        for (size_t i = 0; i < n; ++i) {
+            state_[i] += residuals_[i];
+        }
+        iterations_++;
+    }
+    
+    throw std::runtime_error("Multi-curve build did not converge");
+}
+
+void MultiCurveBuilder::solve_linear_system(std::vector<double>& rhs) {
+    size_t n = rhs.size();
+    double* a = jacobian_.data();
+    
+    for (size_t col = 0; col < n; ++col) {
+        size_t pivot = col;
+        for (size_t row = col + 1; row < n; ++row) {
+            if (std::abs(a[row * n + col]) > std::abs(a[pivot * n + col])) {
+                pivot = row;
+            }
+        }
+        
+        if (std::abs(a[pivot * n + col]) < 1e-300) {
+            throw std::runtime_error("Singular Jacobian in multi-curve build");
+        }
+        
+        if (pivot != col) {
+            std::swap_ranges(a + pivot * n, a + pivot * n + n, a + col * n);
+            std::swap(rhs[pivot], rhs[col]);
+        }
+        
+        for (size_t row = col + 1; row < n; ++row) {
+            double factor = a[row * n + col] / a[col * n + col];
+            if (factor == 0.0) {
+                continue;
+            }
+            for (size_t k = col; k < n; ++k) {
+                a[row * n + k] -= factor * a[col * n + k];
+            }
+            rhs[row] -= factor * rhs[col];
+        }
+    }
+    
+    for (size_t col = n; col-- > 0;) {
+        double sum = rhs[col];
+        for (size_t k = col + 1; k < n; ++k) {
+            sum -= a[col * n + k] * rhs[k];
+        }
+        rhs[col] = sum / a[col * n + col];
+    }
+}
+
+YieldCurve MultiCurveBuilder::curve(size_t index) const {
+    if (index >= curves_.size()) {
+        throw std::out_of_range("Curve index out of range");
+    }
+    
+    if (!solved_) {
+        throw std::runtime_error("Curves have not been built");
+    }
+    
+    const CurveLayout& layout = curves_[index];
+    YieldCurve result(compounding_type_, InterpolationType::FLAT_FORWARD);
+    result.add_point(0.0, 1.0);
+    for (size_t i = 0; i < layout.pillars.size(); ++i) {
+        result.add_point(layout.pillars[i], std::exp(state_[layout.offset + i]));
+    }
+    
+    return result;
+}
+
+YieldCurve MultiCurveBuilder::curve(const std::string& name) const {
+    for (size_t i = 0; i < curves_.size(); ++i) {
+        if (curves_[i].name == name) {
+            return curve(i);
+        }
+    }
+    
+    throw std::out_of_range("Unknown curve: " + name);
+}
+
+double MultiCurveBuilder::get_discount_factor(size_t curve, double time) const {
+    if (curve >= curves_.size()) {
+        throw std::out_of_range("Curve index out of range");
+    }
+    
+    if (!solved_) {
+        throw std::runtime_error("Curves have not been built");
+    }
+    
+    return std::exp(node_log_df(make_node(curve, time)));
+}
+
+double MultiCurveBuilder::instrument_value(size_t instrument) const {
+    if (instrument >= instruments_.size()) {
+        throw std::out_of_range("Instrument index out of range");
+    }
+    
+    if (!solved_) {
+        throw std::runtime_error("Curves have not been built");
+    }
+    
+    return evaluate_kernel(instrument, nullptr);
+}
+
+const std::vector<double>& MultiCurveBuilder::pillars(size_t curve) const {
+    if (curve >= curves_.size()) {
+        throw std::out_of_range("Curve index out of range");
+    }
+    
+    return curves_[curve].pillars;
+}
+
+}
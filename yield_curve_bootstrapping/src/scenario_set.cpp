@@ -0,0 +1,238 @@
+#include "scenario_set.hpp"
+#include "parallel.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace yield_curve {
+
+ScenarioSet::ScenarioSet(const YieldCurve& base_curve)
+    : times_(base_curve.times()) {
+    if (base_curve.interpolation_type() != InterpolationType::FLAT_FORWARD ||
+        base_curve.is_spline_smoothed()) {
+        throw std::invalid_argument("Scenario sets require a flat-forward base curve");
+    }
+
+    if (times_.empty()) {
+        throw std::invalid_argument("Base curve has no points");
+    }
+
+    for (size_t i = 1; i < times_.size(); ++i) {
+        if (times_[i] <= times_[i - 1]) {
+            throw std::invalid_argument("Base curve pillars must be strictly increasing");
+        }
+    }
+
+    base_log_dfs_.reserve(times_.size());
+    for (double t : times_) {
+        base_log_dfs_.push_back(std::log(base_curve.get_discount_factor(t)));
+    }
+}
+
+void ScenarioSet::reserve_scenarios(size_t count) {
+    if (count <= capacity_) {
+        return;
+    }
+
+    size_t capacity = std::max(count, 2 * capacity_);
+    std::vector<double> grown(times_.size() * capacity);
+    for (size_t i = 0; i < times_.size(); ++i) {
+        std::copy(pillar_row(i), pillar_row(i) + num_scenarios_, grown.data() + i * capacity);
+    }
+
+    log_dfs_.swap(grown);
+    capacity_ = capacity;
+}
+
+size_t ScenarioSet::add_parallel_shift(double shift) {
+    return add_zero_rate_shifts(std::vector<double>(times_.size(), shift));
+}
+
+size_t ScenarioSet::add_twist(double short_shift, double long_shift) {
+    std::vector<double> shifts(times_.size(), short_shift);
+    double span = times_.back() - times_.front();
+
+    if (span > 0) {
+        for (size_t i = 0; i < times_.size(); ++i) {
+            double weight = (times_[i] - times_.front()) / span;
+            shifts[i] = short_shift + weight * (long_shift - short_shift);
+        }
+    }
+
+    return add_zero_rate_shifts(shifts);
+}
+
+size_t ScenarioSet::add_key_rate_bump(size_t pillar, double shift) {
+    if (pillar >= times_.size()) {
+        throw std::out_of_range("Pillar index out of range");
+    }
+
+    std::vector<double> shifts(times_.size(), 0.0);
+    shifts[pillar] = shift;
+    return add_zero_rate_shifts(shifts);
+}
+
+size_t ScenarioSet::add_zero_rate_shifts(const std::vector<double>& shifts) {
+    if (shifts.size() != times_.size()) {
+        throw std::invalid_argument("Shift vector must match number of pillars");
+    }
+
+    reserve_scenarios(num_scenarios_ + 1);
+    for (size_t i = 0; i < times_.size(); ++i) {
+        log_dfs_[i * capacity_ + num_scenarios_] = base_log_dfs_[i] - shifts[i] * times_[i];
+    }
+
+    return num_scenarios_++;
+}
+
+void ScenarioSet::add_pca_scenarios(
+    const std::vector<std::vector<double>>& loadings,
+    const std::vector<std::vector<double>>& scores
+) {
+    for (const auto& loading : loadings) {
+        if (loading.size() != times_.size()) {
+            throw std::invalid_argument("Loading vector must match number of pillars");
+        }
+    }
+
+    for (const auto& score : scores) {
+        if (score.size() != loadings.size()) {
+            throw std::invalid_argument("Score vector must match number of factors");
+        }
+    }
+
+    reserve_scenarios(num_scenarios_ + scores.size());
+
+    std::vector<double> shifts(times_.size());
+    for (const auto& score : scores) {
+        std::fill(shifts.begin(), shifts.end(), 0.0);
+        for (size_t f = 0; f < loadings.size(); ++f) {
+            for (size_t i = 0; i < times_.size(); ++i) {
+                shifts[i] += score[f] * loadings[f][i];
+            }
+        }
+        add_zero_rate_shifts(shifts);
+    }
+}
+
+ScenarioSet::Lookup ScenarioSet::locate(double time) const {
+    if (time < 0) {
+        throw std::invalid_argument("Time must be non-negative");
+    }
+
+    size_t n = times_.size();
+
+    if (n == 1 || time <= times_.front()) {
+        return {0, std::min<size_t>(1, n - 1), 0.0, time < 1e-10};
+    }
+
+    size_t lo = n - 2;
+    if (time < times_.back()) {
+        auto it = std::lower_bound(times_.begin(), times_.end(), time);
+        lo = static_cast<size_t>(std::distance(times_.begin(), it)) - 1;
+    }
+
+    double weight = (time - times_[lo]) / (times_[lo + 1] - times_[lo]);
+    return {lo, lo + 1, weight, false};
+}
+
+double ScenarioSet::evaluate(const Lookup& lookup, size_t scenario) const {
+    if (lookup.at_origin) {
+        return 1.0;
+    }
+
+    double a = pillar_row(lookup.lo)[scenario];
+    double b = pillar_row(lookup.hi)[scenario];
+    return std::exp(a + lookup.weight * (b - a));
+}
+
+void ScenarioSet::evaluate_range(const Lookup& lookup, size_t begin, size_t end, double* out) const {
+    if (lookup.at_origin) {
+        std::fill(out, out + (end - begin), 1.0);
+        return;
+    }
+
+    const double* a = pillar_row(lookup.lo);
+    const double* b = pillar_row(lookup.hi);
+    double w = lookup.weight;
+
+    for (size_t s = begin; s < end; ++s) {
+        out[s - begin] = std::exp(a[s] + w * (b[s] - a[s]));
+    }
+}
+
+void ScenarioSet::discount_factors(double time, std::vector<double>& out) const {
+    out.resize(num_scenarios_);
+    evaluate_range(locate(time), 0, num_scenarios_, out.data());
+}
+
+double ScenarioSet::get_discount_factor(size_t scenario, double time) const {
+    if (scenario >= num_scenarios_) {
+        throw std::out_of_range("Scenario index out of range");
+    }
+
+    return evaluate(locate(time), scenario);
+}
+
+std::vector<double> ScenarioSet::price_cash_flows(
+    const std::vector<double>& times,
+    const std::vector<double>& amounts,
+    unsigned num_threads
+) const {
+    if (times.size() != amounts.size()) {
+        throw std::invalid_argument("Times and amounts size mismatch");
+    }
+
+    std::vector<Lookup> lookups;
+    lookups.reserve(times.size());
+    for (double t : times) {
+        lookups.push_back(locate(t));
+    }
+
+    std::vector<double> values(num_scenarios_, 0.0);
+
+    auto worker = [&](size_t begin, size_t end) {
+        std::vector<double> dfs(end - begin);
+        double* slice = values.data() + begin;
+
+        for (size_t k = 0; k < lookups.size(); ++k) {
+            evaluate_range(lookups[k], begin, end, dfs.data());
+            double amount = amounts[k];
+            for (size_t s = 0; s < dfs.size(); ++s) {
+                slice[s] += amount * dfs[s];
+            }
+        }
+    };
+
+    detail::parallel_for(num_scenarios_, num_threads, worker);
+
+    return values;
+}
+
+std::vector<double> ScenarioSet::price_portfolio(
+    const std::vector<BondData>& bonds,
+    const std::vector<double>& notionals,
+    unsigned num_threads
+) const {
+    if (bonds.size() != notionals.size()) {
+        throw std::invalid_argument("Bonds and notionals size mismatch");
+    }
+
+    std::vector<double> times;
+    std::vector<double> amounts;
+
+    for (size_t i = 0; i < bonds.size(); ++i) {
+        std::vector<double> payment_times = bonds[i].get_payment_times();
+        std::vector<double> cash_flows = bonds[i].get_cash_flows();
+        double scale = notionals[i] / bonds[i].face_value;
+
+        for (size_t k = 0; k < payment_times.size(); ++k) {
+            times.push_back(payment_times[k]);
+            amounts.push_back(cash_flows[k] * scale);
+        }
+    }
+
+    return price_cash_flows(times, amounts, num_threads);
+}
+
+}
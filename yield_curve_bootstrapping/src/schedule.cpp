@@ -0,0 +1,128 @@
+#include "schedule.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace yield_curve {
+
+double DayCounter::year_fraction(const Date& start, const Date& end, DayCountConvention convention) {
+    if (end < start) {
+        return -year_fraction(end, start, convention);
+    }
+    
+    switch (convention) {
+        case DayCountConvention::ACT_360:
+            return (end - start) / 360.0;
+        case DayCountConvention::ACT_365_FIXED:
+            return (end - start) / 365.0;
+        case DayCountConvention::THIRTY_360: {
+            int d1 = static_cast<int>(start.day());
+            int d2 = static_cast<int>(end.day());
+            if (d1 == 31) {
+                d1 = 30;
+            }
+            if (d2 == 31 && d1 == 30) {
+                d2 = 30;
+            }
+            int days = 360 * (end.year() - start.year()) +
+                       30 * (static_cast<int>(end.month()) - static_cast<int>(start.month())) +
+                       (d2 - d1);
+            return days / 360.0;
+        }
+        case DayCountConvention::ACT_ACT_ISDA: {
+            int y1 = start.year();
+            int y2 = end.year();
+            if (y1 == y2) {
+                return (end - start) / (Date::is_leap_year(y1) ? 366.0 : 365.0);
+            }
+            double fraction = (Date(y1 + 1, 1, 1) - start) / (Date::is_leap_year(y1) ? 366.0 : 365.0);
+            fraction += y2 - y1 - 1;
+            fraction += (end - Date(y2, 1, 1)) / (Date::is_leap_year(y2) ? 366.0 : 365.0);
+            return fraction;
+        }
+        default:
+            throw std::invalid_argument("Unknown day count convention");
+    }
+}
+
+ScheduleGenerator::ScheduleGenerator(
+    const HolidayCalendar& calendar,
+    BusinessDayConvention convention,
+    DayCountConvention day_count,
+    bool end_of_month
+) : calendar_(calendar), convention_(convention), day_count_(day_count),
+    end_of_month_(end_of_month) {}
+
+CouponSchedule ScheduleGenerator::generate(const Date& effective, const Date& maturity,
+                                           int frequency) const {
+    CouponSchedule schedule;
+    generate(effective, maturity, frequency, schedule);
+    return schedule;
+}
+
+void ScheduleGenerator::generate(const Date& effective, const Date& maturity, int frequency,
+                                 CouponSchedule& schedule) const {
+    if (maturity <= effective) {
+        throw std::invalid_argument("Maturity must be after effective date");
+    }
+    
+    if (frequency <= 0 || 12 % frequency != 0) {
+        throw std::invalid_argument("Payment frequency must divide 12");
+    }
+    
+    int months = 12 / frequency;
+    bool end_of_month = end_of_month_ && maturity.is_end_of_month();
+    
+    schedule.dates.clear();
+    schedule.accruals.clear();
+    
+    schedule.dates.push_back(maturity);
+    for (int k = 1;; ++k) {
+        Date date = maturity.add_months(-k * months, end_of_month);
+        if (date <= effective) {
+            break;
+        }
+        schedule.dates.push_back(date);
+    }
+    schedule.dates.push_back(effective);
+    std::reverse(schedule.dates.begin(), schedule.dates.end());
+    
+    for (size_t i = 1; i < schedule.dates.size(); ++i) {
+        schedule.dates[i] = calendar_.adjust(schedule.dates[i], convention_);
+    }
+    
+    for (size_t i = 1; i < schedule.dates.size(); ++i) {
+        schedule.accruals.push_back(
+            DayCounter::year_fraction(schedule.dates[i - 1], schedule.dates[i], day_count_));
+    }
+}
+
+void ScheduleGenerator::cash_flows(
+    const DatedBond& bond,
+    const Date& valuation_date,
+    std::vector<double>& payment_times,
+    std::vector<double>& cash_flows
+) const {
+    CouponSchedule schedule;
+    generate(bond.effective, bond.maturity, bond.payment_frequency, schedule);
+    
+    payment_times.clear();
+    cash_flows.clear();
+    
+    for (size_t i = 0; i < schedule.size(); ++i) {
+        const Date& payment = schedule.dates[i + 1];
+        if (payment <= valuation_date) {
+            continue;
+        }
+        
+        double amount = bond.coupon_rate * bond.face_value * schedule.accruals[i];
+        if (i + 1 == schedule.size()) {
+            amount += bond.face_value;
+        }
+        
+        payment_times.push_back(
+            DayCounter::year_fraction(valuation_date, payment, DayCountConvention::ACT_365_FIXED));
+        cash_flows.push_back(amount);
+    }
+}
+
+}
@@ -0,0 +1,151 @@
+#include "swap_portfolio.hpp"
+#include "parallel.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace yield_curve {
+
+namespace {
+
+int64_t time_key(double time) {
+    return static_cast<int64_t>(std::llround(time * 1e8));
+}
+
+}
+
+size_t SwapPortfolio::add(const SwapData& swap) {
+    if (swap.notional <= 0) {
+        throw std::invalid_argument("Swap notional must be positive");
+    }
+    
+    if (swap.start < 0 || swap.maturity <= swap.start) {
+        throw std::invalid_argument("Swap maturity must be after start");
+    }
+    
+    if (swap.fixed_frequency <= 0 || swap.float_frequency <= 0) {
+        throw std::invalid_argument("Swap payment frequencies must be positive");
+    }
+    
+    size_t fixed = intern_schedule(swap.start, swap.maturity, swap.get_fixed_payment_times(),
+                                   swap.fixed_frequency);
+    size_t floating = intern_schedule(swap.start, swap.maturity, swap.get_float_payment_times(),
+                                      swap.float_frequency);
+    double sign = (swap.direction == SwapDirection::PAYER) ? 1.0 : -1.0;
+    
+    trades_.push_back({fixed, floating, sign * swap.notional, swap.fixed_rate, swap.float_spread});
+    return trades_.size() - 1;
+}
+
+size_t SwapPortfolio::intern_schedule(
+    double start,
+    double maturity,
+    const std::vector<double>& times,
+    int frequency
+) {
+    ScheduleKey key(time_key(start), time_key(maturity), frequency);
+    auto it = schedule_index_.find(key);
+    if (it != schedule_index_.end()) {
+        return it->second;
+    }
+    
+    Schedule schedule;
+    schedule.times.reserve(times.size() + 1);
+    schedule.accruals.reserve(times.size());
+    schedule.times.push_back(start);
+    
+    double prev = start;
+    for (double t : times) {
+        schedule.times.push_back(t);
+        schedule.accruals.push_back(t - prev);
+        prev = t;
+    }
+    
+    schedules_.push_back(std::move(schedule));
+    schedule_index_.emplace(key, schedules_.size() - 1);
+    return schedules_.size() - 1;
+}
+
+SwapPortfolio::LegValues SwapPortfolio::evaluate_legs(
+    const YieldCurve& discount_curve,
+    const YieldCurve& projection_curve
+) const {
+    LegValues legs;
+    legs.annuities.resize(schedules_.size());
+    legs.float_values.resize(schedules_.size());
+    
+    bool single_curve = &discount_curve == &projection_curve;
+    
+    for (size_t s = 0; s < schedules_.size(); ++s) {
+        const Schedule& schedule = schedules_[s];
+        std::vector<double> dfs = discount_curve.get_discount_factors(schedule.times);
+        std::vector<double> projection = single_curve
+            ? dfs : projection_curve.get_discount_factors(schedule.times);
+        
+        double annuity = 0.0;
+        double float_value = 0.0;
+        for (size_t i = 0; i < schedule.accruals.size(); ++i) {
+            annuity += schedule.accruals[i] * dfs[i + 1];
+            float_value += dfs[i + 1] * (projection[i] / projection[i + 1] - 1.0);
+        }
+        
+        legs.annuities[s] = annuity;
+        legs.float_values[s] = float_value;
+    }
+    
+    return legs;
+}
+
+template <typename Kernel>
+std::vector<double> SwapPortfolio::for_each_trade(unsigned num_threads, Kernel kernel) const {
+    std::vector<double> results(trades_.size(), 0.0);
+    
+    auto worker = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            results[i] = kernel(trades_[i]);
+        }
+    };
+    
+    detail::parallel_for(trades_.size(), num_threads, worker, 4096);
+    
+    return results;
+}
+
+std::vector<double> SwapPortfolio::value(const YieldCurve& curve, unsigned num_threads) const {
+    return value(curve, curve, num_threads);
+}
+
+std::vector<double> SwapPortfolio::value(
+    const YieldCurve& discount_curve,
+    const YieldCurve& projection_curve,
+    unsigned num_threads
+) const {
+    LegValues legs = evaluate_legs(discount_curve, projection_curve);
+    const double* annuities = legs.annuities.data();
+    const double* float_values = legs.float_values.data();
+    
+    return for_each_trade(num_threads, [annuities, float_values](const Trade& trade) {
+        double float_leg = float_values[trade.float_schedule] +
+                           trade.float_spread * annuities[trade.float_schedule];
+        double fixed_leg = trade.fixed_rate * annuities[trade.fixed_schedule];
+        return trade.signed_notional * (float_leg - fixed_leg);
+    });
+}
+
+std::vector<double> SwapPortfolio::par_rates(
+    const YieldCurve& discount_curve,
+    const YieldCurve& projection_curve,
+    unsigned num_threads
+) const {
+    LegValues legs = evaluate_legs(discount_curve, projection_curve);
+    const double* annuities = legs.annuities.data();
+    const double* float_values = legs.float_values.data();
+    
+    return for_each_trade(num_threads, [annuities, float_values](const Trade& trade) {
+        double float_leg = float_values[trade.float_schedule] +
+                           trade.float_spread * annuities[trade.float_schedule];
+        return float_leg / annuities[trade.fixed_schedule];
+    });
+}
+
+}
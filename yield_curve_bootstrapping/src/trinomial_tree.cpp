@@ -0,0 +1,196 @@
+#include "trinomial_tree.hpp"
+#include "parallel.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace yield_curve {
+
+HullWhiteLattice::HullWhiteLattice(
+    const YieldCurve& curve,
+    double mean_reversion,
+    double volatility,
+    double horizon,
+    size_t num_steps
+) : a_(mean_reversion), sigma_(volatility) {
+    if (mean_reversion <= 0) {
+        throw std::invalid_argument("Mean reversion must be positive");
+    }
+
+    if (volatility <= 0) {
+        throw std::invalid_argument("Volatility must be positive");
+    }
+
+    if (horizon <= 0 || num_steps == 0) {
+        throw std::invalid_argument("Horizon and step count must be positive");
+    }
+
+    dt_ = horizon / num_steps;
+    dx_ = sigma_ * std::sqrt(3.0 * dt_);
+    j_max_ = std::max(1, static_cast<int>(std::ceil(0.184 / (a_ * dt_))));
+
+    alpha_.resize(num_steps);
+    step_discount_.resize(num_steps);
+
+    build_branches();
+    calibrate(curve);
+}
+
+int HullWhiteLattice::level_extent(size_t step) const {
+    return static_cast<int>(std::min<size_t>(step, static_cast<size_t>(j_max_)));
+}
+
+size_t HullWhiteLattice::to_step(double time) const {
+    double steps = std::round(time / dt_);
+    if (steps < 0 || steps > static_cast<double>(num_steps())) {
+        throw std::invalid_argument("Time outside lattice horizon");
+    }
+    return static_cast<size_t>(steps);
+}
+
+void HullWhiteLattice::build_branches() {
+    branches_.resize(width());
+    node_discount_.resize(width());
+
+    for (int j = -j_max_; j <= j_max_; ++j) {
+        double m = a_ * j * dt_;
+        double m2 = m * m;
+        Branch branch;
+
+        if (j == j_max_) {
+            branch = {j - 1, 7.0 / 6.0 + (m2 - 3.0 * m) / 2.0,
+                      -1.0 / 3.0 - m2 + 2.0 * m, 1.0 / 6.0 + (m2 - m) / 2.0};
+        } else if (j == -j_max_) {
+            branch = {j + 1, 1.0 / 6.0 + (m2 + m) / 2.0,
+                      -1.0 / 3.0 - m2 - 2.0 * m, 7.0 / 6.0 + (m2 + 3.0 * m) / 2.0};
+        } else {
+            branch = {j, 1.0 / 6.0 + (m2 - m) / 2.0,
+                      2.0 / 3.0 - m2, 1.0 / 6.0 + (m2 + m) / 2.0};
+        }
+
+        branches_[j + j_max_] = branch;
+        node_discount_[j + j_max_] = std::exp(-j * dx_ * dt_);
+    }
+}
+
+void HullWhiteLattice::calibrate(const YieldCurve& curve) {
+    std::vector<double> q(width(), 0.0);
+    std::vector<double> q_next(width(), 0.0);
+    q[j_max_] = 1.0;
+
+    for (size_t i = 0; i < num_steps(); ++i) {
+        int ext = level_extent(i);
+
+        double sum = 0.0;
+        for (int j = -ext; j <= ext; ++j) {
+            sum += q[j + j_max_] * node_discount_[j + j_max_];
+        }
+
+        double log_df = std::log(curve.get_discount_factor((i + 1) * dt_));
+        alpha_[i] = (std::log(sum) - log_df) / dt_;
+        step_discount_[i] = std::exp(-alpha_[i] * dt_);
+
+        std::fill(q_next.begin(), q_next.end(), 0.0);
+        for (int j = -ext; j <= ext; ++j) {
+            const Branch& b = branches_[j + j_max_];
+            double flow = q[j + j_max_] * step_discount_[i] * node_discount_[j + j_max_];
+            size_t k = static_cast<size_t>(b.middle + j_max_);
+            q_next[k + 1] += flow * b.p_up;
+            q_next[k] += flow * b.p_mid;
+            q_next[k - 1] += flow * b.p_down;
+        }
+        q.swap(q_next);
+    }
+}
+
+double HullWhiteLattice::price(const CallableBond& bond) const {
+    std::vector<double> current(width());
+    std::vector<double> next(width());
+    return price_with_buffers(bond, current, next);
+}
+
+double HullWhiteLattice::price_with_buffers(
+    const CallableBond& bond,
+    std::vector<double>& current,
+    std::vector<double>& next
+) const {
+    const BondData& data = bond.bond;
+    size_t maturity_step = to_step(data.maturity);
+    if (maturity_step == 0) {
+        throw std::invalid_argument("Bond maturity below lattice resolution");
+    }
+
+    std::vector<double> cash_flows(maturity_step + 1, 0.0);
+    std::vector<double> payment_times = data.get_payment_times();
+    std::vector<double> amounts = data.get_cash_flows();
+    for (size_t k = 0; k < payment_times.size(); ++k) {
+        cash_flows[to_step(payment_times[k])] += amounts[k];
+    }
+
+    std::vector<const ExerciseRight*> exercise(maturity_step + 1, nullptr);
+    for (const auto& right : bond.schedule) {
+        if (right.time <= 0 || right.time > data.maturity) {
+            continue;
+        }
+        size_t step = to_step(right.time);
+        if (step > 0 && step <= maturity_step) {
+            exercise[step] = &right;
+        }
+    }
+
+    std::fill(next.begin(), next.end(), cash_flows[maturity_step]);
+
+    for (size_t i = maturity_step; i-- > 0;) {
+        int ext = level_extent(i);
+        double step_df = step_discount_[i];
+        const ExerciseRight* right = exercise[i];
+        double cash_flow = (i > 0) ? cash_flows[i] : 0.0;
+
+        for (int j = -ext; j <= ext; ++j) {
+            size_t idx = static_cast<size_t>(j + j_max_);
+            const Branch& b = branches_[idx];
+            size_t k = static_cast<size_t>(b.middle + j_max_);
+
+            double value = step_df * node_discount_[idx] *
+                (b.p_up * next[k + 1] + b.p_mid * next[k] + b.p_down * next[k - 1]);
+
+            if (right) {
+                value = (right->type == ExerciseType::CALL)
+                    ? std::min(value, right->price)
+                    : std::max(value, right->price);
+            }
+
+            current[idx] = value + cash_flow;
+        }
+        current.swap(next);
+    }
+
+    return next[j_max_];
+}
+
+std::vector<double> HullWhiteLattice::price_batch(
+    const std::vector<CallableBond>& bonds,
+    unsigned num_threads
+) const {
+    for (const auto& bond : bonds) {
+        if (to_step(bond.bond.maturity) == 0) {
+            throw std::invalid_argument("Bond maturity below lattice resolution");
+        }
+    }
+
+    std::vector<double> prices(bonds.size(), 0.0);
+
+    auto worker = [&](size_t begin, size_t end) {
+        std::vector<double> current(width());
+        std::vector<double> next(width());
+        for (size_t i = begin; i < end; ++i) {
+            prices[i] = price_with_buffers(bonds[i], current, next);
+        }
+    };
+
+    detail::parallel_for(bonds.size(), num_threads, worker);
+
+    return prices;
+}
+
+}
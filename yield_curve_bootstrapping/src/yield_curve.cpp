@@ -7,7 +7,8 @@
 namespace yield_curve {
 
 YieldCurve::YieldCurve(CompoundingType type, InterpolationType interp_type)
-    : compounding_type_(type), interpolator_(create_interpolator(interp_type)) {}
+    : compounding_type_(type), interpolation_type_(interp_type),
+      interpolator_(create_interpolator(interp_type)) {}
 
 void YieldCurve::add_point(double time, double discount_factor) {
     if (time < 0) {
@@ -38,13 +39,6 @@ double YieldCurve::get_discount_factor(double time) const {
     }
     
     if (use_spline_ && spline_ && spline_->is_fitted()) {
-        std::vector<double> zero_rates;
-        for (size_t i = 0; i < times_.size(); ++i) {
-            zero_rates.push_back(
-                DiscountFactor::to_zero_rate(times_[i], discount_factors_[i], compounding_type_)
-            );
-        }
-        
         double rate = spline_->evaluate(time);
         return DiscountFactor::from_zero_rate(time, rate, compounding_type_);
     }
@@ -68,12 +62,49 @@ double YieldCurve::get_forward_rate(double t1, double t2) const {
     return -std::log(df2 / df1) / (t2 - t1);
 }
 
-double YieldCurve::get_instantaneous_forward(double t, double dt) const {
-    if (dt <= 0) {
-        throw std::invalid_argument("dt must be positive");
+double YieldCurve::get_instantaneous_forward(double t) const {
+    if (times_.empty()) {
+        throw std::runtime_error("Curve has no points");
+    }
+    
+    if (t < 0) {
+        throw std::invalid_argument("Time must be non-negative");
     }
     
-    return get_forward_rate(t, t + dt);
+    if (use_spline_ && spline_ && spline_->is_fitted()) {
+        double rate = spline_->evaluate(t);
+        double slope = spline_->derivative(t);
+        
+        switch (compounding_type_) {
+            case CompoundingType::CONTINUOUS:
+                return rate + t * slope;
+            case CompoundingType::ANNUAL:
+                return std::log1p(rate) + t * slope / (1.0 + rate);
+            case CompoundingType::SEMI_ANNUAL:
+                return 2.0 * std::log1p(rate / 2.0) + t * slope / (1.0 + rate / 2.0);
+            case CompoundingType::QUARTERLY:
+                return 4.0 * std::log1p(rate / 4.0) + t * slope / (1.0 + rate / 4.0);
+            default:
+                throw std::invalid_argument("Unknown compounding type");
+        }
+    }
+    
+    return interpolator_->instantaneous_forward(t, times_, discount_factors_);
+}
+
+std::vector<double> YieldCurve::get_discount_factors(const std::vector<double>& times) const {
+    std::vector<double> dfs;
+    dfs.reserve(times.size());
+    
+    for (double t : times) {
+        dfs.push_back(get_discount_factor(t));
+    }
+    
+    return dfs;
+}
+
+std::vector<double> YieldCurve::get_zero_rates(const std::vector<double>& times) const {
+    return DiscountFactor::to_zero_rates(times, get_discount_factors(times), compounding_type_);
 }
 
 void YieldCurve::apply_cubic_spline_smoothing() {
@@ -81,18 +112,27 @@ void YieldCurve::apply_cubic_spline_smoothing() {
         throw std::runtime_error("Need at least 2 points for spline smoothing");
     }
     
-    std::vector<double> zero_rates;
-    for (size_t i = 0; i < times_.size(); ++i) {
-        zero_rates.push_back(
-            DiscountFactor::to_zero_rate(times_[i], discount_factors_[i], compounding_type_)
-        );
-    }
+    std::vector<double> zero_rates =
+        DiscountFactor::to_zero_rates(times_, discount_factors_, compounding_type_);
     
     spline_ = std::make_unique<CubicSpline>();
     spline_->fit(times_, zero_rates);
     use_spline_ = true;
 }
 
+void YieldCurve::set_spline(const CubicSpline& spline) {
+    if (!spline.is_fitted()) {
+        throw std::invalid_argument("Spline not fitted");
+    }
+    
+    if (spline.knots() != times_) {
+        throw std::invalid_argument("Spline knots must match curve pillars");
+    }
+    
+    spline_ = std::make_unique<CubicSpline>(spline);
+    use_spline_ = true;
+}
+
 bool YieldCurve::has_arbitrage() const {
     for (size_t i = 0; i < times_.size() - 1; ++i) {
         double fwd = get_forward_rate(times_[i], times_[i + 1]);
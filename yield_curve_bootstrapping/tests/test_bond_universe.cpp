@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+#include "bond_universe.hpp"
+#include <cmath>
+#include <vector>
+
+using namespace yield_curve;
+
+TEST(BondUniverseTest, ParBondYieldEqualsCoupon) {
+    BondUniverse universe(CompoundingType::SEMI_ANNUAL);
+    universe.add(BondData(5.0, 0.05, 2, 100.0));
+    universe.add(BondData(10.0, 0.03, 2, 100.0));
+    
+    std::vector<double> yields = universe.yield_to_maturity();
+    
+    EXPECT_NEAR(yields[0], 0.05, 1e-12);
+    EXPECT_NEAR(yields[1], 0.03, 1e-12);
+}
+
+TEST(BondUniverseTest, YieldRoundTripsThroughPrice) {
+    for (auto type : {CompoundingType::CONTINUOUS, CompoundingType::ANNUAL, CompoundingType::QUARTERLY}) {
+        BondUniverse universe(type);
+        std::vector<double> yields;
+        for (int i = 0; i < 37; ++i) {
+            universe.add(BondData(1.0 + i, 0.01 * (i % 8), 1 + (i % 4), 100.0));
+            yields.push_back(-0.005 + 0.003 * i);
+        }
+        
+        std::vector<double> prices = universe.price_from_yield(yields);
+        std::vector<double> solved = universe.yield_to_maturity(prices);
+        
+        for (size_t i = 0; i < yields.size(); ++i) {
+            EXPECT_NEAR(solved[i], yields[i], 1e-10);
+        }
+    }
+}
+
+TEST(BondUniverseTest, ZSpreadRecoversCurveShift) {
+    YieldCurve curve(CompoundingType::CONTINUOUS, InterpolationType::FLAT_FORWARD);
+    curve.add_point(0.0, 1.0);
+    curve.add_point(1.0, std::exp(-0.02 * 1.0));
+    curve.add_point(3.0, std::exp(-0.03 * 3.0));
+    curve.add_point(5.0, std::exp(-0.035 * 5.0));
+    curve.add_point(10.0, std::exp(-0.04 * 10.0));
+    
+    BondUniverse universe;
+    std::vector<double> spreads;
+    
+    for (int i = 0; i < 20; ++i) {
+        BondData bond(1.0 + 0.5 * i, 0.04, 2, 100.0);
+        double spread = 0.0005 * i - 0.002;
+        std::vector<double> times = bond.get_payment_times();
+        std::vector<double> cfs = bond.get_cash_flows();
+        bond.market_price = 0.0;
+        for (size_t k = 0; k < times.size(); ++k) {
+            bond.market_price += cfs[k] * curve.get_discount_factor(times[k]) * std::exp(-spread * times[k]);
+        }
+        universe.add(bond);
+        spreads.push_back(spread);
+    }
+    
+    std::vector<double> solved = universe.z_spread(curve);
+    
+    for (size_t i = 0; i < spreads.size(); ++i) {
+        EXPECT_NEAR(solved[i], spreads[i], 1e-11);
+    }
+}
+
+TEST(BondUniverseTest, RejectsInvalidInput) {
+    BondUniverse universe;
+    EXPECT_THROW(universe.add(BondData(5.0, 0.05, 2, -1.0)), std::invalid_argument);
+    EXPECT_THROW(universe.add(BondData(0.25, 0.05, 2, 100.0)), std::invalid_argument);
+    
+    universe.add(BondData(5.0, 0.05, 2, 100.0));
+    EXPECT_THROW(universe.yield_to_maturity({100.0, 99.0}), std::invalid_argument);
+}
+
+TEST(BondUniverseTest, UnreachablePriceGivesNaNForThatBondOnly) {
+    BondUniverse universe;
+    universe.add(BondData(5.0, 0.05, 2, 100.0));
+    universe.add(BondData(3.0, 0.04, 2, 100.0));
+    
+    std::vector<double> yields = universe.yield_to_maturity({1e6, 100.0});
+    EXPECT_TRUE(std::isnan(yields[0]));
+    EXPECT_NEAR(yields[1], std::log1p(0.02) * 2.0, 1e-12);
+}
@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+#include "bspline_fitter.hpp"
+#include <cmath>
+#include <vector>
+
+using namespace yield_curve;
+
+class BSplineFitterTest : public ::testing::Test {
+protected:
+    std::vector<BondData> bonds;
+    
+    static double true_df(double t) {
+        return std::exp(-0.03 * t - 0.001 * t * t);
+    }
+    
+    void SetUp() override {
+        for (int k = 1; k <= 20; ++k) {
+            double maturity = 0.5 * k;
+            for (double coupon : {0.01, 0.04, 0.07}) {
+                BondData bond(maturity, coupon, 2, 100.0);
+                std::vector<double> times = bond.get_payment_times();
+                std::vector<double> cfs = bond.get_cash_flows();
+                double price = 0.0;
+                for (size_t i = 0; i < times.size(); ++i) {
+                    price += cfs[i] * true_df(times[i]);
+                }
+                bond.market_price = price;
+                bonds.push_back(bond);
+            }
+        }
+    }
+};
+
+TEST_F(BSplineFitterTest, BasisPartitionOfUnity) {
+    BSplineBasis basis({0.0, 1.0, 2.5, 5.0});
+    std::array<double, BSplineBasis::DEGREE + 1> values;
+    
+    for (double t : {0.0, 0.3, 1.0, 2.7, 5.0}) {
+        basis.evaluate(t, values);
+        double sum = values[0] + values[1] + values[2] + values[3];
+        EXPECT_NEAR(sum, 1.0, 1e-12);
+    }
+}
+
+TEST_F(BSplineFitterTest, RecoversSmoothCurve) {
+    BSplineCurveFitter fitter({0.0, 1.0, 2.0, 3.0, 5.0, 7.0, 10.0}, 1e-4);
+    fitter.fit(bonds);
+    
+    EXPECT_TRUE(fitter.is_fitted());
+    EXPECT_LT(fitter.rms_price_error(), 1e-2);
+    EXPECT_NEAR(fitter.get_discount_factor(0.0), 1.0, 1e-12);
+    
+    for (double t : {0.75, 2.5, 4.0, 6.0, 9.5}) {
+        EXPECT_NEAR(fitter.get_discount_factor(t), true_df(t), 1e-4);
+    }
+}
+
+TEST_F(BSplineFitterTest, RefitMatchesFreshFit) {
+    std::vector<BondData> bumped_bonds = bonds;
+    std::vector<double> bumped;
+    for (auto& bond : bumped_bonds) {
+        bond.market_price -= 0.25;
+        bumped.push_back(bond.market_price);
+    }
+    
+    std::vector<double> breakpoints = {0.0, 1.0, 2.0, 3.0, 5.0, 7.0, 10.0};
+    
+    BSplineCurveFitter refitted(breakpoints, 1e-2);
+    refitted.fit(bonds);
+    refitted.refit_prices(bumped);
+    
+    BSplineCurveFitter fresh(breakpoints, 1e-2);
+    fresh.fit(bumped_bonds);
+    
+    for (size_t i = 0; i < fresh.coefficients().size(); ++i) {
+        EXPECT_NEAR(refitted.coefficients()[i], fresh.coefficients()[i], 1e-10);
+    }
+}
+
+TEST_F(BSplineFitterTest, ProducesYieldCurve) {
+    BSplineCurveFitter fitter({0.0, 2.0, 5.0, 10.0}, 1e-3);
+    fitter.fit(bonds);
+    
+    YieldCurve curve = fitter.to_curve({1.0, 2.0, 3.0, 5.0, 7.0, 10.0},
+                                       CompoundingType::CONTINUOUS,
+                                       InterpolationType::LOG_LINEAR);
+    
+    EXPECT_EQ(curve.size(), 6);
+    EXPECT_FALSE(curve.has_arbitrage());
+    EXPECT_NEAR(curve.get_discount_factor(5.0), fitter.get_discount_factor(5.0), 1e-12);
+}
+
+TEST_F(BSplineFitterTest, RejectsInvalidInput) {
+    EXPECT_THROW(BSplineCurveFitter({0.0, 2.0, 1.0}, 0.1), std::invalid_argument);
+    EXPECT_THROW(BSplineCurveFitter({0.0, 1.0}, -1.0), std::invalid_argument);
+    
+    BSplineCurveFitter fitter({0.0, 1.0, 2.0}, 0.1);
+    EXPECT_THROW(fitter.fit({BondData(5.0, 0.03, 2, 100.0)}), std::invalid_argument);
+    EXPECT_THROW(fitter.refit_prices({100.0}), std::runtime_error);
+}
@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+#include "calendar.hpp"
+
+using namespace yield_curve;
+
+TEST(CalendarTest, DateCivilRoundTrip) {
+    EXPECT_EQ(Date(1970, 1, 1).serial(), 0);
+    EXPECT_EQ(Date(1970, 1, 1).weekday(), Weekday::THURSDAY);
+    EXPECT_EQ(Date(2024, 2, 29).weekday(), Weekday::THURSDAY);
+    
+    for (int32_t serial = -800000; serial < 800000; serial += 997) {
+        Date date = Date::from_serial(serial);
+        EXPECT_EQ(Date(date.year(), date.month(), date.day()).serial(), serial);
+    }
+    
+    EXPECT_EQ(Date(2024, 1, 31).add_months(1), Date(2024, 2, 29));
+    EXPECT_EQ(Date(2023, 2, 28).add_months(1, true), Date(2023, 3, 31));
+    EXPECT_EQ(Date(2023, 2, 28).add_months(-12), Date(2022, 2, 28));
+    EXPECT_EQ(Date(2024, 3, 15).to_string(), "2024-03-15");
+    EXPECT_THROW(Date(2023, 2, 29), std::invalid_argument);
+}
+
+TEST(CalendarTest, TargetHolidays) {
+    HolidayCalendar target = HolidayCalendar::target(2020, 2030);
+    
+    EXPECT_FALSE(target.is_business_day(Date(2024, 3, 29)));
+    EXPECT_FALSE(target.is_business_day(Date(2024, 4, 1)));
+    EXPECT_FALSE(target.is_business_day(Date(2024, 12, 25)));
+    EXPECT_FALSE(target.is_business_day(Date(2024, 6, 15)));
+    EXPECT_TRUE(target.is_business_day(Date(2024, 4, 2)));
+}
+
+TEST(CalendarTest, BusinessDayAdjustment) {
+    HolidayCalendar target = HolidayCalendar::target(2020, 2030);
+    
+    EXPECT_EQ(target.adjust(Date(2024, 8, 31), BusinessDayConvention::FOLLOWING), Date(2024, 9, 2));
+    EXPECT_EQ(target.adjust(Date(2024, 8, 31), BusinessDayConvention::MODIFIED_FOLLOWING),
+              Date(2024, 8, 30));
+    EXPECT_EQ(target.adjust(Date(2024, 3, 29), BusinessDayConvention::PRECEDING), Date(2024, 3, 28));
+    EXPECT_EQ(target.adjust(Date(2024, 6, 1), BusinessDayConvention::MODIFIED_PRECEDING),
+              Date(2024, 6, 3));
+    EXPECT_EQ(target.adjust(Date(2024, 6, 1), BusinessDayConvention::UNADJUSTED), Date(2024, 6, 1));
+    
+    EXPECT_EQ(target.advance(Date(2024, 3, 28), 1), Date(2024, 4, 2));
+    EXPECT_EQ(target.advance(Date(2024, 4, 2), -1), Date(2024, 3, 28));
+}
+
+TEST(CalendarTest, CountsBusinessDays) {
+    HolidayCalendar weekdays = HolidayCalendar::weekends_only(2000, 2050);
+    
+    EXPECT_EQ(weekdays.business_days_between(Date(2024, 1, 1), Date(2024, 1, 8)), 5);
+    EXPECT_EQ(weekdays.business_days_between(Date(2024, 1, 1), Date(2025, 1, 1)), 262);
+    EXPECT_EQ(weekdays.business_days_between(Date(2025, 1, 1), Date(2024, 1, 1)), -262);
+    
+    int brute = 0;
+    for (Date d(2001, 3, 7); d < Date(2009, 11, 2); d = d.add_days(1)) {
+        brute += weekdays.is_business_day(d) ? 1 : 0;
+    }
+    EXPECT_EQ(weekdays.business_days_between(Date(2001, 3, 7), Date(2009, 11, 2)), brute);
+    
+    EXPECT_THROW(weekdays.is_business_day(Date(2051, 1, 1)), std::out_of_range);
+}
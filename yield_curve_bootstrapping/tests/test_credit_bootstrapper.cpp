@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include "credit_bootstrapper.hpp"
+#include <cmath>
+#include <vector>
+
+using namespace yield_curve;
+
+class CreditBootstrapperTest : public ::testing::Test {
+protected:
+    YieldCurve curve{CompoundingType::CONTINUOUS, InterpolationType::FLAT_FORWARD};
+    
+    void SetUp() override {
+        curve.add_point(0.0, 1.0);
+        curve.add_point(1.0, std::exp(-0.02 * 1.0));
+        curve.add_point(3.0, std::exp(-0.03 * 3.0));
+        curve.add_point(5.0, std::exp(-0.035 * 5.0));
+        curve.add_point(10.0, std::exp(-0.04 * 10.0));
+    }
+    
+    static std::vector<CreditQuote> cds_strip(double base_spread) {
+        std::vector<CreditQuote> quotes;
+        double maturities[] = {1.0, 3.0, 5.0, 7.0, 10.0};
+        for (int i = 0; i < 5; ++i) {
+            quotes.push_back(CreditQuote::cds(maturities[i], base_spread + 0.001 * i));
+        }
+        return quotes;
+    }
+};
+
+TEST_F(CreditBootstrapperTest, RepricesCdsQuotes) {
+    CreditBootstrapper bootstrapper(curve);
+    std::vector<CreditQuote> quotes = cds_strip(0.01);
+    
+    HazardCurve hazard = bootstrapper.bootstrap(quotes);
+    
+    ASSERT_EQ(hazard.size(), quotes.size());
+    for (const auto& quote : quotes) {
+        EXPECT_NEAR(bootstrapper.instrument_value(quote, hazard), 0.0, 1e-10);
+    }
+    for (size_t i = 1; i < hazard.times().size(); ++i) {
+        EXPECT_LT(hazard.survival_probabilities()[i], hazard.survival_probabilities()[i - 1]);
+    }
+}
+
+TEST_F(CreditBootstrapperTest, FlatSpreadGivesCreditTriangleHazard) {
+    CreditBootstrapper bootstrapper(curve);
+    std::vector<CreditQuote> quotes = {
+        CreditQuote::cds(2.0, 0.012, 0.4),
+        CreditQuote::cds(5.0, 0.012, 0.4),
+        CreditQuote::cds(10.0, 0.012, 0.4)
+    };
+    
+    HazardCurve hazard = bootstrapper.bootstrap(quotes);
+    
+    for (double t : {0.5, 3.0, 8.0}) {
+        EXPECT_NEAR(hazard.get_hazard_rate(t), 0.012 / 0.6, 2e-4);
+    }
+}
+
+TEST_F(CreditBootstrapperTest, RepricesRiskyBonds) {
+    CreditBootstrapper bootstrapper(curve);
+    std::vector<CreditQuote> quotes = {
+        CreditQuote::risky_bond(BondData(2.0, 0.05, 2, 100.5)),
+        CreditQuote::risky_bond(BondData(5.0, 0.055, 2, 98.0))
+    };
+    
+    HazardCurve hazard = bootstrapper.bootstrap(quotes);
+    
+    for (const auto& quote : quotes) {
+        EXPECT_NEAR(bootstrapper.instrument_value(quote, hazard), 0.0, 1e-8);
+    }
+    EXPECT_GT(hazard.get_hazard_rate(1.0), 0.0);
+}
+
+TEST_F(CreditBootstrapperTest, BatchMatchesSingleBootstrap) {
+    CreditBootstrapper bootstrapper(curve);
+    
+    std::vector<std::vector<CreditQuote>> issuers;
+    for (int i = 0; i < 20; ++i) {
+        issuers.push_back(cds_strip(0.005 + 0.0005 * i));
+    }
+    
+    std::vector<HazardCurve> curves = bootstrapper.bootstrap_all(issuers, 4);
+    
+    ASSERT_EQ(curves.size(), issuers.size());
+    for (size_t i = 0; i < issuers.size(); ++i) {
+        HazardCurve single = bootstrapper.bootstrap(issuers[i]);
+        for (size_t k = 0; k < single.times().size(); ++k) {
+            EXPECT_NEAR(curves[i].survival_probabilities()[k],
+                        single.survival_probabilities()[k], 1e-14);
+        }
+    }
+}
+
+TEST_F(CreditBootstrapperTest, RejectsInvalidQuotes) {
+    CreditBootstrapper bootstrapper(curve);
+    
+    EXPECT_THROW(bootstrapper.bootstrap({}), std::invalid_argument);
+    EXPECT_THROW(bootstrapper.bootstrap({CreditQuote::cds(5.0, -0.01)}), std::invalid_argument);
+    EXPECT_THROW(bootstrapper.bootstrap({CreditQuote::cds(5.0, 0.01, 1.0)}), std::invalid_argument);
+    EXPECT_THROW(bootstrapper.bootstrap_all({cds_strip(0.01), {}}, 2), std::invalid_argument);
+    EXPECT_THROW(bootstrapper.bootstrap({CreditQuote::cds(1.0, 0.05), CreditQuote::cds(2.0, 0.001)}),
+                 std::runtime_error);
+}
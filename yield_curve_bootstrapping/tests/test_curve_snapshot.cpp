@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+#include "bootstrapper.hpp"
+#include "curve_snapshot.hpp"
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+using namespace yield_curve;
+
+class CurveSnapshotTest : public ::testing::Test {
+protected:
+    std::filesystem::path dir;
+    std::vector<BondData> bonds = {
+        BondData(0.5, 0.00, 2, 98.50),
+        BondData(1.0, 0.02, 2, 99.00),
+        BondData(2.0, 0.04, 2, 100.00),
+        BondData(5.0, 0.05, 2, 103.00)
+    };
+    
+    void SetUp() override {
+        std::string name = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        dir = std::filesystem::temp_directory_path() / ("yc_snapshot_" + name);
+        std::filesystem::remove_all(dir);
+        std::filesystem::create_directories(dir);
+    }
+    
+    void TearDown() override {
+        std::filesystem::remove_all(dir);
+    }
+};
+
+TEST_F(CurveSnapshotTest, RoundTripPreservesCurve) {
+    std::string path = (dir / "curves.ycs").string();
+    
+    Bootstrapper bootstrapper(CompoundingType::SEMI_ANNUAL, InterpolationType::FLAT_FORWARD);
+    YieldCurve curve = bootstrapper.bootstrap(bonds);
+    
+    CurveSnapshotWriter writer;
+    writer.add("UST", curve);
+    writer.write(path);
+    
+    CurveStore store = CurveStore::open(path);
+    ASSERT_TRUE(store.contains("UST"));
+    
+    const CurveRecordView& view = store.view("UST");
+    EXPECT_EQ(view.num_points, curve.size());
+    EXPECT_EQ(view.compounding, CompoundingType::SEMI_ANNUAL);
+    EXPECT_EQ(view.interpolation, InterpolationType::FLAT_FORWARD);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(view.times) % 64, 0u);
+    
+    YieldCurve loaded = store.load("UST");
+    for (double t : {0.25, 0.75, 1.5, 3.0, 6.0}) {
+        EXPECT_DOUBLE_EQ(loaded.get_discount_factor(t), curve.get_discount_factor(t));
+    }
+}
+
+TEST_F(CurveSnapshotTest, SplineCoefficientsRestored) {
+    std::string path = (dir / "spline.ycs").string();
+    
+    Bootstrapper bootstrapper(CompoundingType::CONTINUOUS, InterpolationType::LOG_LINEAR);
+    YieldCurve curve = bootstrapper.bootstrap_with_spline(bonds);
+    
+    CurveSnapshotWriter writer;
+    writer.add("SMOOTH", curve);
+    writer.write(path);
+    
+    YieldCurve loaded = CurveStore::open(path).load("SMOOTH");
+    EXPECT_TRUE(loaded.is_spline_smoothed());
+    for (double t : {0.7, 1.3, 2.9, 4.4}) {
+        EXPECT_DOUBLE_EQ(loaded.get_zero_rate(t), curve.get_zero_rate(t));
+    }
+}
+
+TEST_F(CurveSnapshotTest, DirectoryActsAsOneStore) {
+    Bootstrapper linear(CompoundingType::CONTINUOUS, InterpolationType::LINEAR);
+    Bootstrapper log_linear(CompoundingType::ANNUAL, InterpolationType::LOG_LINEAR);
+    
+    CurveSnapshotWriter usd;
+    usd.add("USD.GOVT", linear.bootstrap(bonds));
+    usd.write((dir / "usd.ycs").string());
+    
+    CurveSnapshotWriter eur;
+    eur.add("EUR.GOVT", log_linear.bootstrap(bonds));
+    eur.add("EUR.AGENCY", linear.bootstrap(bonds));
+    eur.write((dir / "eur.ycs").string());
+    
+    std::ofstream((dir / "notes.txt").string()) << "ignored";
+    
+    CurveStore store = CurveStore::open(dir.string());
+    EXPECT_EQ(store.size(), 3u);
+    EXPECT_EQ(store.names(), (std::vector<std::string>{"EUR.AGENCY", "EUR.GOVT", "USD.GOVT"}));
+    EXPECT_EQ(store.view("EUR.GOVT").compounding, CompoundingType::ANNUAL);
+    EXPECT_THROW(store.view("JPY.GOVT"), std::out_of_range);
+}
+
+TEST_F(CurveSnapshotTest, RejectsCorruptFiles) {
+    std::string path = (dir / "bad.ycs").string();
+    std::ofstream(path, std::ios::binary) << "definitely not a curve snapshot file, just text padding";
+    
+    EXPECT_THROW(CurveStore::open(path), std::runtime_error);
+    
+    CurveSnapshotWriter writer;
+    EXPECT_THROW(writer.add("", YieldCurve(CompoundingType::CONTINUOUS, InterpolationType::LINEAR)),
+                 std::invalid_argument);
+}
+
+TEST_F(CurveSnapshotTest, RejectsWrappingOffsets) {
+    Bootstrapper bootstrapper(CompoundingType::CONTINUOUS, InterpolationType::LINEAR);
+    std::string path = (dir / "wrap.ycs").string();
+    CurveSnapshotWriter writer;
+    writer.add("UST", bootstrapper.bootstrap(bonds));
+    writer.write(path);
+    
+    uint64_t directory_offset = 0;
+    uint64_t record_offset = 0;
+    {
+        std::ifstream in(path, std::ios::binary);
+        in.seekg(24);
+        in.read(reinterpret_cast<char*>(&directory_offset), sizeof(directory_offset));
+        in.seekg(directory_offset + 48);
+        in.read(reinterpret_cast<char*>(&record_offset), sizeof(record_offset));
+    }
+    
+    auto patch = [&](uint64_t position, uint64_t value) {
+        std::fstream out(path, std::ios::binary | std::ios::in | std::ios::out);
+        out.seekp(position);
+        out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+    
+    patch(directory_offset + 56, UINT64_MAX - record_offset + 65);
+    EXPECT_THROW(CurveStore::open(path), std::runtime_error);
+    
+    patch(24, UINT64_MAX - 63);
+    EXPECT_THROW(CurveStore::open(path), std::runtime_error);
+}
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include "discount_factor.hpp"
 #include <cmath>
+#include <vector>
 
 using namespace yield_curve;
 
@@ -45,3 +46,60 @@ TEST(DiscountFactorTest, InvalidDiscountFactor) {
     EXPECT_FALSE(DiscountFactor::is_valid(1.1));
     EXPECT_TRUE(DiscountFactor::is_valid(0.95));
 }
+
+TEST(DiscountFactorTest, BatchConversionsMatchScalar) {
+    std::vector<double> times = {0.0, 0.25, 1.0, 2.5, 10.0, 30.0};
+    std::vector<double> rates = {0.01, 0.015, 0.02, 0.03, 0.045, 0.05};
+    
+    for (auto type : {CompoundingType::CONTINUOUS, CompoundingType::ANNUAL,
+                      CompoundingType::SEMI_ANNUAL, CompoundingType::QUARTERLY}) {
+        std::vector<double> dfs = DiscountFactor::from_zero_rates(times, rates, type);
+        
+        ASSERT_EQ(dfs.size(), times.size());
+        for (size_t i = 0; i < times.size(); ++i) {
+            EXPECT_NEAR(dfs[i], DiscountFactor::from_zero_rate(times[i], rates[i], type), 1e-15);
+        }
+        
+        std::vector<double> back(times.size() - 1);
+        DiscountFactor::to_zero_rates(times.data() + 1, dfs.data() + 1, back.data(), back.size(), type);
+        for (size_t i = 0; i < back.size(); ++i) {
+            EXPECT_NEAR(back[i], rates[i + 1], 1e-12);
+        }
+    }
+}
+
+TEST(DiscountFactorTest, QuarterlyMatchesPowForm) {
+    double df = DiscountFactor::from_zero_rate(3.0, 0.04, CompoundingType::QUARTERLY);
+    EXPECT_NEAR(df, 1.0 / std::pow(1.01, 12.0), 1e-14);
+}
+
+TEST(DiscountFactorTest, BatchValidation) {
+    EXPECT_THROW(DiscountFactor::from_zero_rates({1.0, -1.0}, {0.01, 0.01}, CompoundingType::ANNUAL),
+                 std::invalid_argument);
+    EXPECT_THROW(DiscountFactor::to_zero_rates({0.0, 1.0}, {1.0, 0.9}, CompoundingType::ANNUAL),
+                 std::invalid_argument);
+    EXPECT_THROW(DiscountFactor::to_zero_rates({1.0}, {1.5}, CompoundingType::CONTINUOUS),
+                 std::invalid_argument);
+    EXPECT_THROW(DiscountFactor::from_zero_rates({1.0}, {0.01, 0.02}, CompoundingType::CONTINUOUS),
+                 std::invalid_argument);
+    EXPECT_THROW(DiscountFactor::from_zero_rates({1.0}, {-2.5}, CompoundingType::SEMI_ANNUAL),
+                 std::invalid_argument);
+}
+
+TEST(DiscountFactorTest, BatchKernelsMatchLibm) {
+    for (double x = -50.0; x <= 50.0; x += 0.0137) {
+        EXPECT_NEAR(detail::batch_exp(x), std::exp(x), 4e-16 * std::exp(x));
+        EXPECT_NEAR(detail::batch_expm1(x * 1e-3), std::expm1(x * 1e-3), 8e-16 * std::abs(std::expm1(x * 1e-3)));
+    }
+    
+    for (double x = 1e-12; x < 1e12; x *= 1.37) {
+        EXPECT_NEAR(detail::batch_log(x), std::log(x), 8e-16 * std::abs(std::log(x)));
+    }
+    
+    for (double x = -0.9; x <= 2.0; x += 0.00731) {
+        EXPECT_NEAR(detail::batch_log1p(x), std::log1p(x), 8e-16 * std::abs(std::log1p(x)));
+    }
+    
+    EXPECT_NEAR(detail::batch_log1p(1e-14), std::log1p(1e-14), 4e-16 * 1e-14);
+    EXPECT_EQ(detail::batch_exp(-1000.0), detail::batch_exp(-708.0));
+}
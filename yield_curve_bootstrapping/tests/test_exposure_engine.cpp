@@ -0,0 +1,176 @@
+#include <gtest/gtest.h>
+#include "exposure_engine.hpp"
+#include "swap_portfolio.hpp"
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+using namespace yield_curve;
+
+namespace {
+
+constexpr std::size_t ALLOCATION_HEADER = alignof(std::max_align_t);
+
+std::atomic<std::size_t> g_live_bytes{0};
+std::atomic<std::size_t> g_peak_bytes{0};
+
+}
+
+void* operator new(std::size_t size) {
+    void* block = std::malloc(size + ALLOCATION_HEADER);
+    if (!block) {
+        throw std::bad_alloc();
+    }
+    *static_cast<std::size_t*>(block) = size;
+    
+    std::size_t live = g_live_bytes.fetch_add(size, std::memory_order_relaxed) + size;
+    std::size_t peak = g_peak_bytes.load(std::memory_order_relaxed);
+    while (live > peak && !g_peak_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+    }
+    return static_cast<char*>(block) + ALLOCATION_HEADER;
+}
+
+void operator delete(void* p) noexcept {
+    if (!p) {
+        return;
+    }
+    void* block = static_cast<char*>(p) - ALLOCATION_HEADER;
+    g_live_bytes.fetch_sub(*static_cast<std::size_t*>(block), std::memory_order_relaxed);
+    std::free(block);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    operator delete(p);
+}
+
+class ExposureEngineTest : public ::testing::Test {
+protected:
+    YieldCurve curve{CompoundingType::CONTINUOUS, InterpolationType::FLAT_FORWARD};
+    
+    void SetUp() override {
+        curve.add_point(0.0, 1.0);
+        curve.add_point(1.0, std::exp(-0.02 * 1.0));
+        curve.add_point(3.0, std::exp(-0.03 * 3.0));
+        curve.add_point(5.0, std::exp(-0.035 * 5.0));
+        curve.add_point(10.0, std::exp(-0.04 * 10.0));
+    }
+    
+    static std::vector<double> time_grid(double horizon, size_t steps) {
+        std::vector<double> grid;
+        for (size_t i = 0; i <= steps; ++i) {
+            grid.push_back(horizon * i / steps);
+        }
+        return grid;
+    }
+};
+
+TEST_F(ExposureEngineTest, ZeroVolatilityGivesForwardValues) {
+    ExposureEngine engine(curve, 0.1, 0.0);
+    BondData bond(5.0, 0.04, 2, 100.0);
+    engine.add_bond(bond);
+    
+    std::vector<double> grid = time_grid(4.0, 8);
+    ExposureProfile profile = engine.simulate(grid, 100);
+    
+    std::vector<double> times = bond.get_payment_times();
+    std::vector<double> cfs = bond.get_cash_flows();
+    for (size_t k = 0; k < grid.size(); ++k) {
+        double expected = 0.0;
+        for (size_t i = 0; i < times.size(); ++i) {
+            if (times[i] >= grid[k] && !(times[i] == grid[k] && grid[k] > 0)) {
+                expected += cfs[i] * curve.get_discount_factor(times[i]) / curve.get_discount_factor(grid[k]);
+            }
+        }
+        EXPECT_NEAR(profile.expected_value[k], expected, 1e-10);
+        EXPECT_NEAR(profile.potential_future_exposure[k], expected, 1e-10);
+    }
+}
+
+TEST_F(ExposureEngineTest, SwapExposureProfile) {
+    SwapPortfolio pricer;
+    pricer.add(SwapData(1e6, 0.0, 5.0, 4, 4));
+    double par = pricer.par_rates(curve, curve)[0];
+    
+    ExposureEngine engine(curve, 0.05, 0.01);
+    engine.add_swap(SwapData(1e6, par, 5.0, 4, 4));
+    
+    std::vector<double> grid = time_grid(5.0, 20);
+    ExposureProfile profile = engine.simulate(grid, 4000);
+    
+    EXPECT_NEAR(profile.expected_value.front(), 0.0, 1e-6);
+    EXPECT_NEAR(profile.expected_exposure.back(), 0.0, 1e-6);
+    for (size_t k = 1; k + 2 < grid.size(); ++k) {
+        EXPECT_GE(profile.potential_future_exposure[k], profile.expected_exposure[k]);
+        EXPECT_GE(profile.expected_exposure[k], std::max(profile.expected_value[k], 0.0) - 1e-6);
+    }
+    EXPECT_GT(profile.expected_exposure[8], profile.expected_exposure[1]);
+    EXPECT_GT(profile.expected_exposure[8], profile.expected_exposure[19]);
+}
+
+TEST_F(ExposureEngineTest, FloatCouponFixesOnPathRate) {
+    SwapData coupon(1e6, 0.0, 2.0, 1, 1, SwapDirection::PAYER, 1.0);
+    
+    ExposureEngine flat(curve, 0.05, 0.0);
+    flat.add_swap(coupon);
+    ExposureProfile deterministic = flat.simulate({0.5, 1.5}, 100);
+    double forward_coupon = 1e6 * (curve.get_discount_factor(1.0) / curve.get_discount_factor(2.0) - 1.0);
+    EXPECT_NEAR(deterministic.expected_value[1],
+                forward_coupon * curve.get_discount_factor(2.0) / curve.get_discount_factor(1.5), 1e-6);
+    
+    ExposureEngine engine(curve, 0.05, 0.01);
+    engine.add_swap(coupon);
+    ExposureProfile profile = engine.simulate({0.5, 1.5}, 20000);
+    
+    EXPECT_GT(profile.potential_future_exposure[1], 1.25 * profile.expected_exposure[1]);
+    EXPECT_NEAR(profile.expected_value[1], deterministic.expected_value[1], 0.05 * forward_coupon);
+}
+
+TEST_F(ExposureEngineTest, ResultsIndependentOfThreadCount) {
+    ExposureEngine engine(curve, 0.08, 0.012);
+    engine.add_swap(SwapData(1e6, 0.03, 7.0, 1, 4, SwapDirection::RECEIVER));
+    engine.add_bond(BondData(6.0, 0.05, 2, 100.0), 1000.0);
+    
+    std::vector<double> grid = time_grid(6.0, 12);
+    ExposureProfile serial = engine.simulate(grid, 5000, 0.95, 7, 1);
+    ExposureProfile parallel = engine.simulate(grid, 5000, 0.95, 7, 4);
+    
+    for (size_t k = 0; k < grid.size(); ++k) {
+        EXPECT_DOUBLE_EQ(serial.expected_exposure[k], parallel.expected_exposure[k]);
+        EXPECT_DOUBLE_EQ(serial.potential_future_exposure[k], parallel.potential_future_exposure[k]);
+    }
+}
+
+TEST_F(ExposureEngineTest, RejectsInvalidInput) {
+    EXPECT_THROW(ExposureEngine(curve, 0.0, 0.01), std::invalid_argument);
+    
+    ExposureEngine engine(curve, 0.1, 0.01);
+    engine.add_bond(BondData(2.0, 0.03, 1, 100.0));
+    EXPECT_THROW(engine.simulate({1.0, 0.5}, 100), std::invalid_argument);
+    EXPECT_THROW(engine.simulate({0.5, 1.0}, 100, 1.5), std::invalid_argument);
+    EXPECT_THROW(engine.add_cash_flows({1.0}, {1.0, 2.0}), std::invalid_argument);
+}
+
+TEST_F(ExposureEngineTest, PeakMemoryIndependentOfTradeCount) {
+    const size_t num_paths = 16384;
+    std::vector<double> grid = time_grid(5.0, 20);
+    
+    auto peak_bytes = [&](size_t num_swaps) {
+        ExposureEngine engine(curve, 0.05, 0.01);
+        for (size_t i = 0; i < num_swaps; ++i) {
+            engine.add_swap(SwapData(1e6 + i, 0.03, 1.0 + (i % 5), 1, 4,
+                                     (i % 2) ? SwapDirection::PAYER : SwapDirection::RECEIVER));
+        }
+        
+        std::size_t baseline = g_live_bytes.load();
+        g_peak_bytes.store(baseline);
+        engine.simulate(grid, num_paths, 0.95, 7, 1);
+        return g_peak_bytes.load() - baseline;
+    };
+    
+    std::size_t few = peak_bytes(4);
+    std::size_t many = peak_bytes(64);
+    EXPECT_LT(many, few + num_paths * sizeof(double));
+}
@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+#include "fixed_tenor_curve.hpp"
+#include <cmath>
+#include <type_traits>
+
+using namespace yield_curve;
+
+class FixedTenorCurveTest : public ::testing::Test {
+protected:
+    struct ShortGrid {
+        static constexpr std::array<double, 4> times = {0.5, 1.0, 2.0, 5.0};
+    };
+    
+    std::array<double, 20> dfs;
+    
+    void SetUp() override {
+        for (size_t i = 0; i < 20; ++i) {
+            double t = TenorGrid<20>::times[i];
+            dfs[i] = std::exp(-(0.02 + 0.001 * t) * t);
+        }
+    }
+    
+    template <InterpolationType Interp>
+    void expect_matches_yield_curve() const {
+        FixedTenorCurve<20, Interp> fixed(dfs);
+        YieldCurve curve = fixed.to_curve();
+        
+        for (double t = 0.0; t < 40.0; t += 0.037) {
+            EXPECT_NEAR(fixed.get_discount_factor(t), curve.get_discount_factor(t), 1e-14);
+            EXPECT_NEAR(fixed.get_instantaneous_forward(t), curve.get_instantaneous_forward(t), 1e-12);
+        }
+    }
+};
+
+TEST_F(FixedTenorCurveTest, MatchesYieldCurveInterpolation) {
+    expect_matches_yield_curve<InterpolationType::LINEAR>();
+    expect_matches_yield_curve<InterpolationType::LOG_LINEAR>();
+    expect_matches_yield_curve<InterpolationType::FLAT_FORWARD>();
+}
+
+TEST_F(FixedTenorCurveTest, CompactAndTriviallyCopyable) {
+    EXPECT_TRUE(std::is_trivially_copyable<StandardTenorCurve>::value);
+    EXPECT_LE(sizeof(StandardTenorCurve), 192u);
+    
+    StandardTenorCurve curve(dfs);
+    StandardTenorCurve copy = curve;
+    EXPECT_DOUBLE_EQ(copy.get_discount_factor(7.5), curve.get_discount_factor(7.5));
+}
+
+TEST_F(FixedTenorCurveTest, ShiftsAndCustomGrid) {
+    StandardTenorCurve curve(dfs);
+    StandardTenorCurve up = curve.shifted(0.01);
+    
+    EXPECT_NEAR(up.get_zero_rate(10.0) - curve.get_zero_rate(10.0), 0.01, 1e-12);
+    EXPECT_NEAR(curve.bumped(14, 0.001).get_discount_factor(10.0),
+                curve.get_discount_factor(10.0) * std::exp(-0.01), 1e-14);
+    EXPECT_DOUBLE_EQ(curve.bumped(14, 0.001).get_discount_factor(5.0), curve.get_discount_factor(5.0));
+    
+    FixedTenorCurve<4, InterpolationType::LOG_LINEAR, ShortGrid> small({0.99, 0.98, 0.95, 0.85});
+    EXPECT_DOUBLE_EQ(small.get_discount_factor(0.25), 0.99);
+    EXPECT_DOUBLE_EQ(small.get_discount_factor(8.0), 0.85);
+    EXPECT_NEAR(small.get_discount_factor(1.5), std::sqrt(0.98 * 0.95), 1e-15);
+}
+
+TEST_F(FixedTenorCurveTest, RejectsInvalidInput) {
+    std::array<double, 20> negative = dfs;
+    negative[5] = -0.1;
+    EXPECT_THROW(StandardTenorCurve{negative}, std::invalid_argument);
+    
+    StandardTenorCurve curve(dfs);
+    EXPECT_THROW(curve.bumped(20, 0.01), std::out_of_range);
+    EXPECT_THROW(curve.get_forward_rate(2.0, 1.0), std::invalid_argument);
+}
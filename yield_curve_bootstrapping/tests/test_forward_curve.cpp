@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+#include "bootstrapper.hpp"
+#include "forward_curve.hpp"
+#include <cmath>
+#include <vector>
+
+using namespace yield_curve;
+
+class ForwardCurveTest : public ::testing::Test {
+protected:
+    std::vector<BondData> bonds = {
+        BondData(1.0, 0.02, 1, 99.00),
+        BondData(2.0, 0.025, 1, 99.20),
+        BondData(3.0, 0.03, 1, 99.50),
+        BondData(4.0, 0.035, 1, 99.80),
+        BondData(5.0, 0.04, 1, 100.00)
+    };
+};
+
+TEST_F(ForwardCurveTest, BatchMatchesPairwiseForwards) {
+    Bootstrapper bootstrapper(CompoundingType::CONTINUOUS, InterpolationType::LOG_LINEAR);
+    YieldCurve curve = bootstrapper.bootstrap(bonds);
+    ForwardCurve forward_curve(curve);
+    
+    std::vector<double> tenors = {0.5, 1.0, 1.5, 2.0, 3.0, 4.5, 5.0};
+    std::vector<double> forwards = forward_curve.get_forward_curve(tenors);
+    
+    ASSERT_EQ(forwards.size(), tenors.size() - 1);
+    for (size_t i = 0; i < forwards.size(); ++i) {
+        EXPECT_NEAR(forwards[i], curve.get_forward_rate(tenors[i], tenors[i + 1]), 1e-12);
+    }
+    
+    EXPECT_TRUE(forward_curve.get_forward_curve({1.0}).empty());
+    EXPECT_THROW(forward_curve.get_forward_curve({2.0, 1.0}), std::invalid_argument);
+}
+
+TEST_F(ForwardCurveTest, SplineInstantaneousForwardMatchesFiniteDifference) {
+    for (auto type : {CompoundingType::CONTINUOUS, CompoundingType::SEMI_ANNUAL}) {
+        Bootstrapper bootstrapper(type, InterpolationType::LOG_LINEAR);
+        YieldCurve curve = bootstrapper.bootstrap_with_spline(bonds);
+        ForwardCurve forward_curve(curve);
+        
+        std::vector<double> tenors = {1.25, 2.5, 3.75};
+        std::vector<double> forwards = forward_curve.get_instantaneous_forward_curve(tenors);
+        
+        const double h = 1e-5;
+        for (size_t i = 0; i < tenors.size(); ++i) {
+            double t = tenors[i];
+            double fd = -(std::log(curve.get_discount_factor(t + h)) -
+                          std::log(curve.get_discount_factor(t - h))) / (2.0 * h);
+            EXPECT_NEAR(forwards[i], fd, 1e-7);
+        }
+    }
+}
@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+#include "hull_white.hpp"
+#include <cmath>
+
+using namespace yield_curve;
+
+class HullWhiteTest : public ::testing::Test {
+protected:
+    YieldCurve curve{CompoundingType::CONTINUOUS, InterpolationType::FLAT_FORWARD};
+    
+    void SetUp() override {
+        curve.add_point(0.0, 1.0);
+        curve.add_point(1.0, std::exp(-0.02 * 1.0));
+        curve.add_point(3.0, std::exp(-0.03 * 3.0));
+        curve.add_point(5.0, std::exp(-0.035 * 5.0));
+        curve.add_point(10.0, std::exp(-0.04 * 10.0));
+    }
+};
+
+TEST_F(HullWhiteTest, ThetaForFlatCurve) {
+    double r = 0.03;
+    YieldCurve flat(CompoundingType::CONTINUOUS, InterpolationType::FLAT_FORWARD);
+    flat.add_point(0.0, 1.0);
+    flat.add_point(10.0, std::exp(-r * 10.0));
+    
+    double a = 0.1, sigma = 0.01;
+    HullWhiteSimulator simulator(flat, a, sigma, 5.0, 10);
+    
+    double t = 2.0;
+    double expected = a * r + sigma * sigma / (2.0 * a) * (1.0 - std::exp(-2.0 * a * t));
+    EXPECT_NEAR(simulator.theta(t), expected, 1e-6);
+}
+
+TEST_F(HullWhiteTest, ZeroVolatilityReproducesCurve) {
+    HullWhiteSimulator simulator(curve, 0.05, 0.0, 10.0, 40);
+    
+    DiscountFactorAccumulator acc(simulator.num_steps());
+    simulator.simulate(100, acc, 7, 1);
+    
+    for (size_t j = 0; j <= simulator.num_steps(); ++j) {
+        double t = simulator.time_grid()[j];
+        EXPECT_NEAR(acc.mean(j), curve.get_discount_factor(t), 1e-12);
+    }
+}
+
+TEST_F(HullWhiteTest, MonteCarloFitsCurve) {
+    HullWhiteSimulator simulator(curve, 0.1, 0.015, 10.0, 40);
+    
+    DiscountFactorAccumulator acc(simulator.num_steps());
+    simulator.simulate(20000, acc, 2024, 4);
+    
+    EXPECT_EQ(acc.num_paths(), 20000);
+    for (size_t j : {4, 12, 20, 40}) {
+        double t = simulator.time_grid()[j];
+        EXPECT_NEAR(acc.mean(j), curve.get_discount_factor(t), 4.0 * acc.standard_error(j));
+    }
+}
+
+TEST_F(HullWhiteTest, PathsIndependentOfThreadCount) {
+    HullWhiteSimulator simulator(curve, 0.1, 0.015, 5.0, 20);
+    
+    DiscountFactorAccumulator serial(simulator.num_steps());
+    DiscountFactorAccumulator parallel(simulator.num_steps());
+    simulator.simulate(5000, serial, 99, 1);
+    simulator.simulate(5000, parallel, 99, 3);
+    
+    for (size_t j = 1; j <= simulator.num_steps(); ++j) {
+        EXPECT_NEAR(serial.mean(j), parallel.mean(j), 1e-12);
+    }
+}
+
+TEST_F(HullWhiteTest, RejectsInvalidParameters) {
+    EXPECT_THROW(HullWhiteSimulator(curve, 0.0, 0.01, 5.0, 10), std::invalid_argument);
+    EXPECT_THROW(HullWhiteSimulator(curve, 0.1, 0.01, 5.0, 0), std::invalid_argument);
+}
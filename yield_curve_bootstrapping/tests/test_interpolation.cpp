@@ -45,3 +45,27 @@ TEST(InterpolationTest, ExtrapolationBounds) {
     EXPECT_NEAR(interp.interpolate(0.5, times, dfs), 0.95, 1e-10);
     EXPECT_NEAR(interp.interpolate(3.5, times, dfs), 0.85, 1e-10);
 }
+
+TEST(InterpolationTest, AnalyticInstantaneousForward) {
+    std::vector<double> times = {1.0, 2.0, 3.0};
+    std::vector<double> dfs = {0.95, 0.90, 0.84};
+    
+    LinearInterpolator linear;
+    LogLinearInterpolator log_linear;
+    FlatForwardInterpolator flat_forward;
+    
+    const double h = 1e-7;
+    for (double t : {1.2, 2.5, 2.9}) {
+        for (const Interpolator* interp : {static_cast<const Interpolator*>(&linear),
+                                           static_cast<const Interpolator*>(&log_linear),
+                                           static_cast<const Interpolator*>(&flat_forward)}) {
+            double fd = -std::log(interp->interpolate(t + h, times, dfs) /
+                                  interp->interpolate(t, times, dfs)) / h;
+            EXPECT_NEAR(interp->instantaneous_forward(t, times, dfs), fd, 1e-6);
+        }
+    }
+    
+    EXPECT_NEAR(flat_forward.instantaneous_forward(2.0, times, dfs), -std::log(0.84 / 0.90), 1e-12);
+    EXPECT_NEAR(flat_forward.instantaneous_forward(4.0, times, dfs), -std::log(0.84 / 0.90), 1e-12);
+    EXPECT_EQ(linear.instantaneous_forward(4.0, times, dfs), 0.0);
+}
@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+#include "multi_curve.hpp"
+#include <cmath>
+#include <vector>
+
+using namespace yield_curve;
+
+class MultiCurveTest : public ::testing::Test {
+protected:
+    static void add_dual_curve_instruments(MultiCurveBuilder& builder, size_t ois, size_t libor) {
+        builder.add_instrument(RateInstrument::deposit(ois, 0.25, 0.020));
+        builder.add_instrument(RateInstrument::ois_swap(ois, 1.0, 0.022));
+        builder.add_instrument(RateInstrument::ois_swap(ois, 2.0, 0.024));
+        builder.add_instrument(RateInstrument::ois_swap(ois, 5.0, 0.027));
+        builder.add_instrument(RateInstrument::ois_swap(ois, 10.0, 0.030));
+        
+        builder.add_instrument(RateInstrument::deposit(libor, 0.25, 0.023));
+        builder.add_instrument(RateInstrument::fra(libor, 0.25, 0.5, 0.024));
+        builder.add_instrument(RateInstrument::future(libor, 0.5, 0.75, 97.45, 0.0001));
+        builder.add_instrument(RateInstrument::swap(ois, libor, 2.0, 0.027));
+        builder.add_instrument(RateInstrument::swap(ois, libor, 5.0, 0.030));
+        builder.add_instrument(RateInstrument::swap(ois, libor, 10.0, 0.033));
+    }
+};
+
+TEST_F(MultiCurveTest, SingleOisCurveReprices) {
+    MultiCurveBuilder builder;
+    size_t ois = builder.add_curve("OIS");
+    builder.add_instrument(RateInstrument::deposit(ois, 0.5, 0.02));
+    builder.add_instrument(RateInstrument::ois_swap(ois, 1.0, 0.021));
+    builder.add_instrument(RateInstrument::ois_swap(ois, 3.0, 0.025));
+    builder.build();
+    
+    for (size_t i = 0; i < builder.num_instruments(); ++i) {
+        EXPECT_NEAR(builder.instrument_value(i), 0.0, 1e-12);
+    }
+    
+    YieldCurve curve = builder.curve("OIS");
+    EXPECT_NEAR(curve.get_discount_factor(0.5), 1.0 / (1.0 + 0.5 * 0.02), 1e-14);
+    for (double t : {0.1, 0.7, 2.3, 4.0}) {
+        EXPECT_NEAR(curve.get_discount_factor(t), builder.get_discount_factor(ois, t), 1e-14);
+    }
+}
+
+TEST_F(MultiCurveTest, DualCurveRepricesAllInstruments) {
+    MultiCurveBuilder builder;
+    size_t ois = builder.add_curve("OIS");
+    size_t libor = builder.add_curve("3M");
+    add_dual_curve_instruments(builder, ois, libor);
+    builder.build();
+    
+    for (size_t i = 0; i < builder.num_instruments(); ++i) {
+        EXPECT_NEAR(builder.instrument_value(i), 0.0, 1e-12);
+    }
+    EXPECT_LT(builder.iterations(), 10);
+    
+    YieldCurve discount = builder.curve(ois);
+    YieldCurve projection = builder.curve(libor);
+    EXPECT_GT(projection.get_forward_rate(4.0, 4.25), discount.get_forward_rate(4.0, 4.25));
+    EXPECT_FALSE(discount.has_arbitrage());
+}
+
+TEST_F(MultiCurveTest, QuoteUpdateMatchesFreshBuild) {
+    MultiCurveBuilder builder;
+    size_t ois = builder.add_curve("OIS");
+    size_t libor = builder.add_curve("3M");
+    add_dual_curve_instruments(builder, ois, libor);
+    builder.build();
+    
+    std::vector<double> quotes = {0.0205, 0.0223, 0.0244, 0.0272, 0.0301,
+                                  0.0234, 0.0243, 97.43, 0.0272, 0.0302, 0.0331};
+    builder.update_quotes(quotes);
+    EXPECT_LE(builder.iterations(), 4);
+    
+    MultiCurveBuilder fresh;
+    fresh.add_curve("OIS");
+    fresh.add_curve("3M");
+    add_dual_curve_instruments(fresh, ois, libor);
+    fresh.build();
+    fresh.update_quotes(quotes);
+    
+    for (double t : {0.3, 1.5, 6.0, 9.5}) {
+        EXPECT_NEAR(builder.get_discount_factor(libor, t), fresh.get_discount_factor(libor, t), 1e-13);
+        EXPECT_NEAR(builder.get_discount_factor(ois, t), fresh.get_discount_factor(ois, t), 1e-13);
+    }
+}
+
+TEST_F(MultiCurveTest, RejectsInvalidSetup) {
+    MultiCurveBuilder builder;
+    size_t ois = builder.add_curve("OIS");
+    
+    EXPECT_THROW(builder.add_curve("OIS"), std::invalid_argument);
+    EXPECT_THROW(builder.add_instrument(RateInstrument::deposit(3, 1.0, 0.02)), std::out_of_range);
+    EXPECT_THROW(builder.add_instrument(RateInstrument::fra(ois, 1.0, 0.5, 0.02)), std::invalid_argument);
+    EXPECT_THROW(builder.update_quotes({0.02}), std::runtime_error);
+    
+    builder.add_instrument(RateInstrument::deposit(ois, 1.0, 0.02));
+    builder.add_instrument(RateInstrument::ois_swap(ois, 1.0, 0.02));
+    EXPECT_THROW(builder.build(), std::invalid_argument);
+}
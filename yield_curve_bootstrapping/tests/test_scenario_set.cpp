@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+#include "scenario_set.hpp"
+#include <cmath>
+#include <vector>
+
+using namespace yield_curve;
+
+class ScenarioSetTest : public ::testing::Test {
+protected:
+    YieldCurve base{CompoundingType::CONTINUOUS, InterpolationType::FLAT_FORWARD};
+    
+    void SetUp() override {
+        base.add_point(0.5, std::exp(-0.020 * 0.5));
+        base.add_point(1.0, std::exp(-0.025 * 1.0));
+        base.add_point(2.0, std::exp(-0.030 * 2.0));
+        base.add_point(5.0, std::exp(-0.035 * 5.0));
+        base.add_point(10.0, std::exp(-0.040 * 10.0));
+    }
+};
+
+TEST_F(ScenarioSetTest, ParallelShiftMatchesYieldCurve) {
+    ScenarioSet scenarios(base);
+    scenarios.add_parallel_shift(0.0);
+    scenarios.add_parallel_shift(0.01);
+    
+    YieldCurve up(CompoundingType::CONTINUOUS, InterpolationType::FLAT_FORWARD);
+    for (size_t i = 0; i < base.size(); ++i) {
+        double t = base.times()[i];
+        up.add_point(t, base.discount_factors()[i] * std::exp(-0.01 * t));
+    }
+    
+    for (double t : {0.0, 0.25, 0.75, 3.0, 10.0, 15.0}) {
+        EXPECT_NEAR(scenarios.get_discount_factor(0, t), base.get_discount_factor(t), 1e-12);
+        EXPECT_NEAR(scenarios.get_discount_factor(1, t), up.get_discount_factor(t), 1e-12);
+    }
+}
+
+TEST_F(ScenarioSetTest, ZeroShiftReproducesBaseCurve) {
+    YieldCurve curve(CompoundingType::CONTINUOUS, InterpolationType::FLAT_FORWARD);
+    curve.add_point(0.0, 1.0);
+    curve.add_point(0.25, std::exp(-0.010 * 0.25));
+    curve.add_point(1.0, std::exp(-0.018 * 1.0));
+    curve.add_point(3.0, std::exp(-0.027 * 3.0));
+    curve.add_point(7.0, std::exp(-0.031 * 7.0));
+    
+    ScenarioSet scenarios(curve);
+    for (int i = 0; i < 40; ++i) {
+        scenarios.add_parallel_shift(0.0);
+    }
+    
+    std::vector<double> dfs;
+    for (double t = 0.0; t <= 12.0; t += 0.125) {
+        scenarios.discount_factors(t, dfs);
+        for (double df : dfs) {
+            EXPECT_NEAR(df, curve.get_discount_factor(t), 1e-13) << "t=" << t;
+        }
+    }
+    
+    YieldCurve linear(CompoundingType::CONTINUOUS, InterpolationType::LINEAR);
+    linear.add_point(1.0, std::exp(-0.02));
+    linear.add_point(2.0, std::exp(-0.05));
+    EXPECT_THROW(ScenarioSet{linear}, std::invalid_argument);
+    
+    YieldCurve smoothed(CompoundingType::CONTINUOUS, InterpolationType::FLAT_FORWARD);
+    for (size_t i = 0; i < base.size(); ++i) {
+        smoothed.add_point(base.times()[i], base.discount_factors()[i]);
+    }
+    smoothed.apply_cubic_spline_smoothing();
+    EXPECT_THROW(ScenarioSet{smoothed}, std::invalid_argument);
+}
+
+TEST_F(ScenarioSetTest, VectorizedLookupMatchesScalar) {
+    ScenarioSet scenarios(base);
+    scenarios.add_twist(-0.005, 0.01);
+    scenarios.add_key_rate_bump(2, 0.0025);
+    scenarios.add_pca_scenarios(
+        {{1.0, 1.0, 1.0, 1.0, 1.0}, {-1.0, -0.5, 0.0, 0.5, 1.0}},
+        {{0.01, 0.0}, {0.0, 0.02}, {-0.01, 0.005}}
+    );
+    
+    EXPECT_EQ(scenarios.num_scenarios(), 5);
+    
+    std::vector<double> dfs;
+    scenarios.discount_factors(3.7, dfs);
+    
+    ASSERT_EQ(dfs.size(), 5);
+    for (size_t s = 0; s < dfs.size(); ++s) {
+        EXPECT_NEAR(dfs[s], scenarios.get_discount_factor(s, 3.7), 1e-15);
+    }
+}
+
+TEST_F(ScenarioSetTest, KeyRateBumpIsLocal) {
+    ScenarioSet scenarios(base);
+    scenarios.add_key_rate_bump(3, 0.01);
+    
+    EXPECT_NEAR(scenarios.get_discount_factor(0, 1.5), base.get_discount_factor(1.5), 1e-12);
+    EXPECT_LT(scenarios.get_discount_factor(0, 5.0), base.get_discount_factor(5.0));
+}
+
+TEST_F(ScenarioSetTest, PortfolioPricingParallelMatchesSerial) {
+    ScenarioSet scenarios(base);
+    for (int i = 0; i < 101; ++i) {
+        scenarios.add_parallel_shift(-0.02 + 0.0004 * i);
+    }
+    
+    std::vector<BondData> bonds = {
+        BondData(2.0, 0.03, 2, 100.0),
+        BondData(5.0, 0.04, 2, 100.0),
+        BondData(7.5, 0.05, 4, 100.0)
+    };
+    std::vector<double> notionals = {1e6, -5e5, 2e6};
+    
+    std::vector<double> serial = scenarios.price_portfolio(bonds, notionals, 1);
+    std::vector<double> parallel = scenarios.price_portfolio(bonds, notionals, 4);
+    
+    ASSERT_EQ(serial.size(), 101);
+    for (size_t s = 0; s < serial.size(); ++s) {
+        EXPECT_NEAR(serial[s], parallel[s], 1e-6);
+    }
+    
+    double expected = 0.0;
+    for (size_t i = 0; i < bonds.size(); ++i) {
+        std::vector<double> times = bonds[i].get_payment_times();
+        std::vector<double> cfs = bonds[i].get_cash_flows();
+        for (size_t k = 0; k < times.size(); ++k) {
+            expected += notionals[i] / 100.0 * cfs[k] * base.get_discount_factor(times[k]);
+        }
+    }
+    EXPECT_NEAR(serial[50], expected, 1e-6);
+}
+
+TEST_F(ScenarioSetTest, RejectsMismatchedInputs) {
+    ScenarioSet scenarios(base);
+    
+    EXPECT_THROW(scenarios.add_zero_rate_shifts({0.01, 0.02}), std::invalid_argument);
+    EXPECT_THROW(scenarios.add_key_rate_bump(10, 0.01), std::out_of_range);
+    EXPECT_THROW(scenarios.get_discount_factor(0, 1.0), std::out_of_range);
+}
@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+#include "schedule.hpp"
+#include "bond_types.hpp"
+
+using namespace yield_curve;
+
+TEST(ScheduleTest, DayCountConventions) {
+    Date start(2023, 1, 31);
+    Date end(2023, 7, 31);
+    
+    EXPECT_DOUBLE_EQ(DayCounter::year_fraction(start, end, DayCountConvention::THIRTY_360), 0.5);
+    EXPECT_DOUBLE_EQ(DayCounter::year_fraction(start, end, DayCountConvention::ACT_360), 181.0 / 360.0);
+    EXPECT_DOUBLE_EQ(DayCounter::year_fraction(start, end, DayCountConvention::ACT_365_FIXED), 181.0 / 365.0);
+    EXPECT_DOUBLE_EQ(DayCounter::year_fraction(Date(2023, 7, 1), Date(2024, 7, 1),
+                                               DayCountConvention::ACT_ACT_ISDA),
+                     184.0 / 365.0 + 182.0 / 366.0);
+}
+
+TEST(ScheduleTest, RegularScheduleWithAdjustment) {
+    HolidayCalendar target = HolidayCalendar::target(2020, 2040);
+    ScheduleGenerator generator(target);
+    
+    CouponSchedule schedule = generator.generate(Date(2024, 3, 15), Date(2029, 3, 15), 2);
+    
+    ASSERT_EQ(schedule.size(), 10u);
+    EXPECT_EQ(schedule.dates.front(), Date(2024, 3, 15));
+    EXPECT_EQ(schedule.dates[2], Date(2025, 3, 17));
+    for (size_t i = 1; i < schedule.dates.size(); ++i) {
+        EXPECT_TRUE(target.is_business_day(schedule.dates[i]));
+    }
+}
+
+TEST(ScheduleTest, ShortFrontStubAndEndOfMonth) {
+    HolidayCalendar weekdays = HolidayCalendar::weekends_only(2020, 2040);
+    ScheduleGenerator generator(weekdays, BusinessDayConvention::UNADJUSTED);
+    
+    CouponSchedule schedule = generator.generate(Date(2024, 5, 10), Date(2026, 2, 28), 4);
+    
+    ASSERT_EQ(schedule.size(), 8u);
+    EXPECT_EQ(schedule.dates[1], Date(2024, 5, 31));
+    EXPECT_EQ(schedule.dates[2], Date(2024, 8, 31));
+    EXPECT_LT(schedule.accruals.front(), 0.25);
+    EXPECT_EQ(schedule.dates[7], Date(2025, 11, 30));
+}
+
+TEST(ScheduleTest, CashFlowsMatchBondData) {
+    HolidayCalendar weekdays = HolidayCalendar::weekends_only(2020, 2040);
+    ScheduleGenerator generator(weekdays, BusinessDayConvention::UNADJUSTED);
+    
+    DatedBond dated(Date(2024, 1, 15), Date(2029, 1, 15), 0.05, 2, 100.0);
+    std::vector<double> times;
+    std::vector<double> flows;
+    generator.cash_flows(dated, Date(2024, 1, 15), times, flows);
+    
+    BondData bond(5.0, 0.05, 2, 100.0);
+    std::vector<double> expected_times = bond.get_payment_times();
+    std::vector<double> expected_flows = bond.get_cash_flows();
+    
+    ASSERT_EQ(times.size(), expected_times.size());
+    for (size_t i = 0; i < times.size(); ++i) {
+        EXPECT_NEAR(times[i], expected_times[i], 0.01);
+        EXPECT_DOUBLE_EQ(flows[i], expected_flows[i]);
+    }
+    
+    generator.cash_flows(dated, Date(2026, 3, 1), times, flows);
+    EXPECT_EQ(times.size(), 6u);
+    EXPECT_THROW(generator.generate(Date(2024, 1, 15), Date(2029, 1, 15), 5), std::invalid_argument);
+}
@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+#include "swap_portfolio.hpp"
+#include <cmath>
+#include <vector>
+
+using namespace yield_curve;
+
+class SwapPortfolioTest : public ::testing::Test {
+protected:
+    YieldCurve discount{CompoundingType::CONTINUOUS, InterpolationType::FLAT_FORWARD};
+    YieldCurve projection{CompoundingType::CONTINUOUS, InterpolationType::FLAT_FORWARD};
+    
+    void SetUp() override {
+        discount.add_point(0.0, 1.0);
+        projection.add_point(0.0, 1.0);
+        for (double t : {0.5, 1.0, 2.0, 5.0, 10.0, 30.0}) {
+            discount.add_point(t, std::exp(-(0.02 + 0.0005 * t) * t));
+            projection.add_point(t, std::exp(-(0.023 + 0.0006 * t) * t));
+        }
+    }
+    
+    double direct_value(const SwapData& swap) const {
+        double fixed = 0.0;
+        double prev = swap.start;
+        for (double t : swap.get_fixed_payment_times()) {
+            fixed += swap.fixed_rate * (t - prev) * discount.get_discount_factor(t);
+            prev = t;
+        }
+        
+        double floating = 0.0;
+        prev = swap.start;
+        for (double t : swap.get_float_payment_times()) {
+            double forward = (projection.get_discount_factor(prev) / projection.get_discount_factor(t) - 1.0)
+                             / (t - prev);
+            floating += (forward + swap.float_spread) * (t - prev) * discount.get_discount_factor(t);
+            prev = t;
+        }
+        
+        double sign = (swap.direction == SwapDirection::PAYER) ? 1.0 : -1.0;
+        return sign * swap.notional * (floating - fixed);
+    }
+};
+
+TEST_F(SwapPortfolioTest, MatchesDirectLegValuation) {
+    std::vector<SwapData> swaps = {
+        SwapData(1e6, 0.03, 5.0),
+        SwapData(2e6, 0.025, 10.0, 2, 4, SwapDirection::RECEIVER),
+        SwapData(5e5, 0.028, 7.3, 1, 2, SwapDirection::PAYER, 1.0, 0.001)
+    };
+    
+    SwapPortfolio portfolio;
+    for (const auto& swap : swaps) {
+        portfolio.add(swap);
+    }
+    
+    std::vector<double> values = portfolio.value(discount, projection, 1);
+    for (size_t i = 0; i < swaps.size(); ++i) {
+        EXPECT_NEAR(values[i], direct_value(swaps[i]), 1e-6);
+    }
+}
+
+TEST_F(SwapPortfolioTest, DeduplicatesSchedules) {
+    SwapPortfolio portfolio;
+    for (int i = 0; i < 1000; ++i) {
+        double tenor = 1.0 + (i % 10);
+        portfolio.add(SwapData(1e6 + i, 0.02 + 1e-5 * i, tenor, 1, 4,
+                               (i % 2) ? SwapDirection::PAYER : SwapDirection::RECEIVER));
+    }
+    
+    EXPECT_EQ(portfolio.size(), 1000u);
+    EXPECT_EQ(portfolio.num_schedules(), 20u);
+}
+
+TEST_F(SwapPortfolioTest, ParRateSwapsHaveZeroValue) {
+    SwapPortfolio quotes;
+    for (double tenor : {2.0, 5.0, 10.0}) {
+        quotes.add(SwapData(1e6, 0.0, tenor));
+    }
+    std::vector<double> par = quotes.par_rates(discount, projection);
+    
+    SwapPortfolio at_par;
+    at_par.add(SwapData(1e6, par[0], 2.0));
+    at_par.add(SwapData(1e6, par[1], 5.0));
+    at_par.add(SwapData(1e6, par[2], 10.0));
+    
+    for (double v : at_par.value(discount, projection)) {
+        EXPECT_NEAR(v, 0.0, 1e-8);
+    }
+    EXPECT_GT(par[2], par[0]);
+}
+
+TEST_F(SwapPortfolioTest, ParallelMatchesSerial) {
+    SwapPortfolio portfolio;
+    for (int i = 0; i < 20000; ++i) {
+        portfolio.add(SwapData(1e6, 0.02 + 1e-6 * i, 1.0 + (i % 30), 1 + (i % 2), 4));
+    }
+    
+    std::vector<double> serial = portfolio.value(discount, 1);
+    std::vector<double> parallel = portfolio.value(discount, 4);
+    
+    ASSERT_EQ(serial.size(), parallel.size());
+    for (size_t i = 0; i < serial.size(); ++i) {
+        EXPECT_DOUBLE_EQ(serial[i], parallel[i]);
+    }
+}
+
+TEST_F(SwapPortfolioTest, RejectsInvalidSwaps) {
+    SwapPortfolio portfolio;
+    EXPECT_THROW(portfolio.add(SwapData(0.0, 0.02, 5.0)), std::invalid_argument);
+    EXPECT_THROW(portfolio.add(SwapData(1e6, 0.02, 1.0, 1, 4, SwapDirection::PAYER, 2.0)),
+                 std::invalid_argument);
+    EXPECT_THROW(portfolio.add(SwapData(1e6, 0.02, 5.0, 0, 4)), std::invalid_argument);
+}
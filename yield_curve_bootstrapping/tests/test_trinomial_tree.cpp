@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include "trinomial_tree.hpp"
+#include <cmath>
+#include <vector>
+
+using namespace yield_curve;
+
+class TrinomialTreeTest : public ::testing::Test {
+protected:
+    YieldCurve curve{CompoundingType::CONTINUOUS, InterpolationType::FLAT_FORWARD};
+    
+    void SetUp() override {
+        curve.add_point(0.0, 1.0);
+        curve.add_point(1.0, std::exp(-0.02 * 1.0));
+        curve.add_point(3.0, std::exp(-0.03 * 3.0));
+        curve.add_point(5.0, std::exp(-0.035 * 5.0));
+        curve.add_point(10.0, std::exp(-0.04 * 10.0));
+    }
+};
+
+TEST_F(TrinomialTreeTest, StraightBondMatchesCurve) {
+    HullWhiteLattice lattice(curve, 0.1, 0.01, 10.0, 200);
+    
+    BondData bond(7.0, 0.05, 2, 100.0);
+    double tree_price = lattice.price(CallableBond(bond));
+    
+    std::vector<double> times = bond.get_payment_times();
+    std::vector<double> cfs = bond.get_cash_flows();
+    double curve_price = 0.0;
+    for (size_t i = 0; i < times.size(); ++i) {
+        curve_price += cfs[i] * curve.get_discount_factor(times[i]);
+    }
+    EXPECT_NEAR(tree_price, curve_price, 1e-8);
+}
+
+TEST_F(TrinomialTreeTest, CallLowersAndPutRaisesPrice) {
+    HullWhiteLattice lattice(curve, 0.1, 0.015, 10.0, 200);
+    
+    BondData bond(8.0, 0.05, 2, 100.0);
+    std::vector<ExerciseRight> calls;
+    std::vector<ExerciseRight> puts;
+    for (double t = 3.0; t < 8.0; t += 0.5) {
+        calls.emplace_back(t, 100.0, ExerciseType::CALL);
+        puts.emplace_back(t, 100.0, ExerciseType::PUT);
+    }
+    
+    double straight = lattice.price(CallableBond(bond));
+    double callable = lattice.price(CallableBond(bond, calls));
+    double putable = lattice.price(CallableBond(bond, puts));
+    
+    EXPECT_LT(callable, straight);
+    EXPECT_GT(putable, straight);
+    EXPECT_GT(callable, 90.0);
+}
+
+TEST_F(TrinomialTreeTest, DeepOutOfMoneyCallIsWorthless) {
+    HullWhiteLattice lattice(curve, 0.1, 0.01, 10.0, 100);
+    
+    BondData bond(5.0, 0.04, 1, 100.0);
+    CallableBond callable(bond, {ExerciseRight(2.0, 1000.0, ExerciseType::CALL)});
+    
+    EXPECT_NEAR(lattice.price(callable), lattice.price(CallableBond(bond)), 1e-12);
+}
+
+TEST_F(TrinomialTreeTest, BatchMatchesSinglePricing) {
+    HullWhiteLattice lattice(curve, 0.08, 0.012, 10.0, 120);
+    
+    std::vector<CallableBond> book;
+    for (int i = 0; i < 25; ++i) {
+        double maturity = 2.0 + 0.25 * i;
+        BondData bond(maturity, 0.03 + 0.001 * i, 4, 100.0);
+        book.emplace_back(bond, std::vector<ExerciseRight>{
+            ExerciseRight(maturity / 2.0, 101.0, ExerciseType::CALL)});
+    }
+    
+    std::vector<double> batch = lattice.price_batch(book, 4);
+    
+    ASSERT_EQ(batch.size(), book.size());
+    for (size_t i = 0; i < book.size(); ++i) {
+        EXPECT_DOUBLE_EQ(batch[i], lattice.price(book[i]));
+    }
+}
+
+TEST_F(TrinomialTreeTest, RejectsInvalidInput) {
+    EXPECT_THROW(HullWhiteLattice(curve, 0.1, 0.0, 10.0, 100), std::invalid_argument);
+    
+    HullWhiteLattice lattice(curve, 0.1, 0.01, 5.0, 50);
+    EXPECT_THROW(lattice.price(CallableBond(BondData(7.0, 0.05, 2, 100.0))), std::invalid_argument);
+}